@@ -21,21 +21,35 @@
 
 
 #include "application.hpp"
+#include "../game/input_recording.hpp"
 #include "../reference/container.hpp"
-#include "../util/file.hpp"
+#include "../reference/hot_reload.hpp"
 #include "../util/monitor.hpp"
 #include "../util/sound.hpp"
+#include "../util/startup_profile.hpp"
 #include "screens/application/splash_screen.hpp"
+#include "screens/game/main_game_screen.hpp"
+#include <SFML/OpenGL.hpp>
 #include <SFML/System.hpp>
 #include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <thread>
 
 
+using namespace std::literals;
+
+
+static const constexpr auto continuation_budget = 2ms;
+// How long an idle screen dozes for before checking for events, continuations and music again
+static const constexpr auto idle_nap = 10ms;
+
+
 static sequential_music open_sequential_application_music(bool sound) {
 	if(!sound)
 		return {};
 
-	auto files = list_files(sound_root + "/main_menu");
+	auto files = packed_assets.list(sound_root + "/main_menu");
 	files.erase(std::remove_if(files.begin(), files.end(), [&](auto && val) { return val.find("music") != 0; }), files.end());
 	files.shrink_to_fit();
 	return sequential_music(files.size(), [&](unsigned int id) {
@@ -47,68 +61,211 @@ static sequential_music open_sequential_application_music(bool sound) {
 
 unsigned int application::effective_FPS() {
 	static const auto vsync_fps = refresh_rate();
-	return app_configuration.vsync ? vsync_fps : app_configuration.FPS;
+	return app_configuration.vsync && vsync_fps ? vsync_fps : app_configuration.FPS;
+}
+
+mpsc_queue<std::function<void()>> & application::main_thread_continuations() {
+	static mpsc_queue<std::function<void()>> continuations;
+	return continuations;
+}
+
+bool application::run_main_thread_continuations() {
+	const auto start = std::chrono::steady_clock::now();
+	auto ran         = false;
+	std::function<void()> continuation;
+	while(main_thread_continuations().pop(continuation)) {
+		continuation();
+		ran = true;
+		if(std::chrono::steady_clock::now() - start >= continuation_budget)
+			break;
+	}
+	return ran;
+}
+
+void application::post_to_main_thread(std::function<void()> continuation) {
+	main_thread_continuations().push(std::move(continuation));
+}
+
+void application::post_to_main_thread(std::weak_ptr<void> guard, std::function<void()> continuation) {
+	post_to_main_thread([guard = std::move(guard), continuation = std::move(continuation) ] {
+		if(const auto alive = guard.lock())
+			continuation();
+	});
+}
+
+void application::record_sessions() noexcept {
+	record_input = true;
+}
+
+void application::start_with_replay(std::string path) {
+	replay_path = std::move(path);
+}
+
+void application::exit_on_first_frame() noexcept {
+	exit_after_first_frame = true;
+}
+
+void application::profile_startup() noexcept {
+	print_startup_profile = true;
+}
+
+void application::print_statistics() noexcept {
+	print_stats = true;
 }
 
 int application::run() {
 	window.create(sf::VideoMode::getDesktopMode(), app_name, sf::Style::None);
+	startup_phase("window");
 	if(app_configuration.vsync)
 		window.setVerticalSyncEnabled(true);
 	else
-		window.setFramerateLimit(app_configuration.FPS);
+		pacer = std::make_unique<frame_pacer>(app_configuration.FPS);
 	window.setMouseCursorVisible(false);
-	mouse_pointer.loadFromFile(textures_root + "/gui/general/cursor.png");
+	mouse_pointer.loadFromImage(cursor_image);
 
 
 	{
-		sf::Image icon;
-		if(icon.loadFromFile(textures_root + "/gui/general/window_main.png"))
+		const sf::Image & icon = window_icon_image;
+		if(icon.getSize().x)
 			window.setIcon(icon.getSize().x, icon.getSize().x, icon.getPixelsPtr());
 	}
+	startup_phase("cursor and icon");
 
-	schedule_screen<splash_screen>(app_configuration.splash_length * effective_FPS());
-	return loop();
+	if(app_configuration.hot_reload_assets)
+		start_asset_hot_reload();
+
+	if(replay_path.empty())
+		schedule_screen<splash_screen>(std::chrono::seconds(app_configuration.splash_length));
+	else {
+		auto replay = std::make_unique<input_replay>(replay_path);
+		if(const auto err = replay->error()) {
+			std::cerr << "Failed to read recording " << replay_path << ": " << err << '\n';
+			return 1;
+		}
+		schedule_screen<main_game_screen>(std::move(replay));
+	}
+	startup_phase("first screen");
+
+	const auto result = loop();
+	if(print_stats) {
+		if(pacer)
+			std::cout << pacer->summary() << '\n';
+		if(input_latency.count())
+			std::cout << input_latency.summary("Input to present") << '\n';
+		if(input_sample_times.count())
+			std::cout << input_sample_times.summary("Input sampling") << '\n';
+	}
+	return result;
 }
 
 int application::loop() {
 	retry_music();
 
+	auto redraw = true;
 	while(window.isOpen()) {
+		redraw |= run_main_thread_continuations();
+
 		while(temp_screen) {
 			current_screen = move(temp_screen);
 			current_screen->setup();
+			redraw = true;
 		}
 
 		if(const int i = current_screen->loop())
 			return i;
 		music.tick();
 
-		if(const int i = draw())
-			return i;
+		const auto now         = std::chrono::steady_clock::now();
+		const auto wants_frame = redraw || !current_screen->idle();
+		if(wants_frame && (focused || now >= next_background_frame)) {
+			if(const int i = draw())
+				return i;
+			redraw = false;
+
+			if(!focused)
+				next_background_frame = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+				                                  std::chrono::duration<float>(1.f / std::max(app_configuration.background_FPS, 1u)));
+		} else {
+			const auto wake = wants_frame ? next_background_frame : current_screen->wake_time();
+			if(wake <= now)
+				redraw = true;
+			else if(main_thread_continuations().empty())
+				std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(idle_nap, wake - now));
+		}
 
 		sf::Event event;
-		while(window.pollEvent(event))
+		while(window.pollEvent(event)) {
+			redraw = true;
+			if(event.type == sf::Event::LostFocus || event.type == sf::Event::GainedFocus)
+				focus_changed(event.type == sf::Event::GainedFocus);
 			if(const int i = current_screen->handle_event(event))
 				return i;
+		}
 	}
 	return 0;
 }
 
 int application::draw() {
+	const auto sample_start = std::chrono::steady_clock::now();
+	frame_input             = tick_input::sample(window);
+	input_sample_times.record(std::chrono::steady_clock::now() - sample_start);
+
 	window.clear(sf::Color::Black);
 
 	if(const int i = current_screen->draw())
 		return i;
 
-	mouse_pointer.setPosition(static_cast<sf::Vector2f>(sf::Mouse::getPosition(window)));
+	mouse_pointer.setPosition(static_cast<sf::Vector2f>(frame_input.mouse));
 	window.draw(mouse_pointer);
 
 	window.display();
+	if(app_configuration.low_latency && app_configuration.low_latency_gl_finish)  // Don't let the driver queue up frames ahead of the display
+		glFinish();
+	if(frame_input_polled != std::chrono::steady_clock::time_point{}) {
+		input_latency.record(std::chrono::steady_clock::now() - frame_input_polled);
+		frame_input_polled = {};
+	}
+	if(pacer) {
+		pacer->wait();
+		if(!focused || current_screen->idle())
+			pacer->skip();
+	}
+	if(!first_frame_displayed) {
+		first_frame_displayed = true;
+		const auto displayed  = startup_phase("first frame");
+		if(print_startup_profile || exit_after_first_frame)
+			std::cout << "First frame displayed after " << std::chrono::duration_cast<std::chrono::milliseconds>(displayed - process_start).count() << "ms\n";
+		if(print_startup_profile)
+			std::cout << "Startup profile:\n" << startup_profile_summary();
+		if(exit_after_first_frame)
+			window.close();
+	}
 	return 0;
 }
 
+void application::input_shown(std::chrono::steady_clock::time_point polled) noexcept {
+	if(frame_input_polled == std::chrono::steady_clock::time_point{} || polled < frame_input_polled)
+		frame_input_polled = polled;
+}
+
+const tick_input & application::input() const noexcept {
+	return frame_input;
+}
+
+void application::focus_changed(bool focus) {
+	focused               = focus;
+	next_background_frame = {};
+
+	music.setVolume(output_volume(app_configuration.music_volume) * audio_gain());
+	sound_voices.duck(audio_gain());
+}
+
+float application::audio_gain() const noexcept {
+	return focused ? 1.f : app_configuration.background_volume;
+}
+
 void application::retry_music() {
 	music = open_sequential_application_music(app_configuration.play_sounds);
-	music.setVolume(output_volume(app_configuration.music_volume));
+	music.setVolume(output_volume(app_configuration.music_volume) * audio_gain());
 	music.play();
 }
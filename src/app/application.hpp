@@ -23,11 +23,18 @@
 #pragma once
 
 
+#include "../game/tick_input.hpp"
 #include "../render/managed_sprite.hpp"
 #include "../sound/sequential_music.hpp"
+#include "../util/frame_pacer.hpp"
+#include "../util/mpsc_queue.hpp"
+#include "../util/timing_stats.hpp"
 #include "screens/screen.hpp"
 #include <SFML/Graphics.hpp>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
 
 
 class application {
@@ -42,15 +49,55 @@ private:
 
 	sf::RenderWindow window;
 	managed_sprite mouse_pointer;
+	std::unique_ptr<frame_pacer> pacer;
 
 	sequential_music music;
 
+	bool record_input           = false;
+	bool first_frame_displayed  = false;
+	bool exit_after_first_frame = false;
+	bool print_startup_profile  = false;
+	bool print_stats            = false;
+	bool focused                = true;
+	std::chrono::steady_clock::time_point next_background_frame;
+	std::chrono::steady_clock::time_point frame_input_polled;
+	timing_stats input_latency;
+	tick_input frame_input{};
+	timing_stats input_sample_times;
+	std::string replay_path;
+
+	static mpsc_queue<std::function<void()>> & main_thread_continuations();
+	static bool run_main_thread_continuations();
+
 	int loop();
 	int draw();
+	/// The frame being drawn shows the effects of input polled at `polled`, measured once it's presented
+	void input_shown(std::chrono::steady_clock::time_point polled) noexcept;
+	/// Input devices as sampled at the start of the frame being drawn; SFML's device state mustn't be queried from anywhere else
+	const tick_input & input() const noexcept;
+	/// Throttle rendering and duck audio while in the background
+	void focus_changed(bool focus);
+	float audio_gain() const noexcept;
 
 public:
 	static unsigned int effective_FPS();
 
+	/// Queue a continuation to be run on the main thread at the start of a following frame, callable from any thread
+	static void post_to_main_thread(std::function<void()> continuation);
+	/// As above, but the continuation is dropped if `guard` has expired by the time it would've been run
+	static void post_to_main_thread(std::weak_ptr<void> guard, std::function<void()> continuation);
+
+
+	/// Record every game session into recordings_root
+	void record_sessions() noexcept;
+	/// Skip straight to replaying the specified recording instead of the splash screen
+	void start_with_replay(std::string path);
+	/// Close the window as soon as the first frame has been displayed
+	void exit_on_first_frame() noexcept;
+	/// Print all startup phases once the first frame has been displayed
+	void profile_startup() noexcept;
+	/// Print frame, tick, input and audio statistics when they're done being collected
+	void print_statistics() noexcept;
 
 	int run();
 
@@ -40,6 +40,11 @@
 using namespace std::literals;
 
 
+void main_menu_screen::play_sound(const std::string & path) {
+	if(app_configuration.play_sounds)
+		sound_voices.play(path, output_volume(app_configuration.sound_effect_volume * .8), voice_priority::interface);
+}
+
 void main_menu_screen::move_selection(main_menu_screen::direction dir, bool end = false) {
 	const auto max_idx     = main_buttons.size() - 1;
 	auto desired_selection = selected;
@@ -60,31 +65,25 @@ void main_menu_screen::move_selection(main_menu_screen::direction dir, bool end
 	}
 
 	desired_selection = std::min(max_idx, desired_selection);
-	if(app_configuration.play_sounds) {
-		if(desired_selection != selected)
-			selected_option_switch_sound->play();
-		else
-			selected_option_unchanged_sound->play();
-	}
+	if(desired_selection != selected)
+		play_sound(selected_option_switch_sound);
+	else
+		play_sound(selected_option_unchanged_sound);
 	selected = desired_selection;
 }
 
 void main_menu_screen::press_button() {
-	if(app_configuration.play_sounds)
-		selected_option_select_sound->play();
+	play_sound(selected_option_select_sound);
 	auto itr = main_buttons.begin();
 	advance(itr, selected);
 	(itr->second)(itr->first);
 }
 
-void main_menu_screen::try_drawings() {
-	if(!(control_frames_counter++ % 10)) {
-		control_frames_counter = 0;
-		if(joystick_drawing.first != sf::Joystick::isConnected(0)) {
-			joystick_drawing.first ^= 1;
-			joystick_drawing.second.move(0, joystick_drawing.second.size().y * .55f * (joystick_drawing.first ? 1 : -1));
-			keys_drawing.move(0, joystick_drawing.second.size().y * .55f * (joystick_drawing.first ? -1 : 1));
-		}
+void main_menu_screen::try_drawings(bool joystick_connected) {
+	if(joystick_drawing.first != joystick_connected) {
+		joystick_drawing.first ^= 1;
+		joystick_drawing.second.move(0, joystick_drawing.second.size().y * .55f * (joystick_drawing.first ? 1 : -1));
+		keys_drawing.move(0, joystick_drawing.second.size().y * .55f * (joystick_drawing.first ? -1 : 1));
 	}
 }
 
@@ -195,21 +194,17 @@ void main_menu_screen::set_config_menu_items() {
 	main_buttons.emplace_front(
 	    sf::Text(fmt::format(global_iser.translate_key("gui.main_menu.text.config_sound_effect_volume"), app_configuration.sound_effect_volume * 100.f),
 	             font_pixelish, 20),
-	    volume_func("gui.main_menu.text.config_sound_effect_volume", app_configuration.sound_effect_volume, [&](auto vol) {
-		    selected_option_switch_sound->setVolume(output_volume(vol * .8));
-		    selected_option_select_sound->setVolume(output_volume(vol * .8));
-		    update_ready_sound->setVolume(output_volume(vol * .8));
-		  }));
+	    volume_func("gui.main_menu.text.config_sound_effect_volume", app_configuration.sound_effect_volume, [](auto) {}));
 	main_buttons.emplace_front(sf::Text(fmt::format(global_iser.translate_key("gui.main_menu.text.config_default_firearm"),
-	                                                firearm::properties().at(app_configuration.player_default_firearm).name),
+	                                                firearm::properties()[firearm::id_of(app_configuration.player_default_firearm)].name),
 	                                    font_pixelish, 20),
-	                           [&, itr = firearm::properties().find(app_configuration.player_default_firearm) ](sf::Text & text) mutable {
-		                           ++itr;
-		                           if(itr == firearm::properties().end())
-			                           itr = firearm::properties().begin();
+	                           [&, id = firearm::id_of(app_configuration.player_default_firearm) ](sf::Text & text) mutable {
+		                           if(++id == firearm::properties().size())
+			                           id = 0;
 
-		                           app_configuration.player_default_firearm = itr->first;
-		                           text.setString(fmt::format(global_iser.translate_key("gui.main_menu.text.config_default_firearm"), itr->second.name));
+		                           const auto & gun                         = firearm::properties()[id];
+		                           app_configuration.player_default_firearm = gun.id;
+		                           text.setString(fmt::format(global_iser.translate_key("gui.main_menu.text.config_default_firearm"), gun.name));
 		                         });
 
 	selected = main_buttons.size() - 1;
@@ -232,48 +227,6 @@ int main_menu_screen::loop() {
 		++buttid;
 	}
 
-	if(std::get<3>(update) && std::get<0>(update).valid()) {
-		std::get<3>(update) = false;
-		std::get<1>(update) = std::thread([&] {
-			auto result = std::get<0>(update).get();
-			std::cout << result.header["X-RateLimit-Remaining"] << " GitHub API accesses left\n";
-
-			if(!(result.status_code >= 200 && result.status_code < 300))
-				std::get<2>(update).setString(fmt::format(global_iser.translate_key("gui.main_menu.text.update_connection_fail"), result.status_code));
-			else {
-				json::value newest_update;
-				json::parse(result.text, newest_update);
-
-				auto new_version_s = newest_update["tag_name"].as<std::string>();
-				new_version_s      = new_version_s.substr(new_version_s.find_first_of("0123456789"));
-
-				if(version::Semver200_version(new_version_s) <= version::Semver200_version(BARBERSANDREBARBS_VERSION))
-					std::get<2>(update).setString(global_iser.translate_key("gui.main_menu.text.update_none_found"));
-				else {
-					if(app_configuration.play_sounds)
-						update_ready_sound->play();
-					std::get<2>(update).setString(fmt::format(global_iser.translate_key("gui.main_menu.text.update_found"), new_version_s));
-
-					main_buttons.emplace_back(
-					    sf::Text(global_iser.translate_key("gui.main_menu.text.update"), font_swirly),
-					    [&, url = newest_update["html_url"].as<std::string>() ](sf::Text &) {
-						    if(!launch_browser(url)) {
-							    main_buttons.clear();
-							    main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.back"), font_swirly),
-							                               [&](sf::Text &) { set_default_menu_items(); });
-							    main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.update_browser_fail_0"), font_pixelish, 20),
-							                               [&](sf::Text &) {});
-							    main_buttons.emplace_front(sf::Text(url, font_pixelish, 20), [&](sf::Text & txt) { copy_to_clipboard(txt.getString()); });
-							    main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.update_browser_fail_1"), font_pixelish, 20),
-							                               [&](sf::Text &) {});
-							    selected = main_buttons.size() - 1;
-						    }
-						  });
-				}
-			}
-		});
-	}
-
 	return 0;
 }
 
@@ -281,12 +234,11 @@ int main_menu_screen::draw() {
 	for(const auto & button : main_buttons)
 		app.window.draw(button.first);
 
-	try_drawings();
 	if(joystick_drawing.first)
 		app.window.draw(joystick_drawing.second);
 	app.window.draw(keys_drawing);
 
-	app.window.draw(std::get<2>(update));
+	app.window.draw(update.second);
 
 	return 0;
 }
@@ -300,8 +252,8 @@ int main_menu_screen::handle_event(const sf::Event & event) {
 			unsigned int buttid = 0;
 			for(const auto & button : main_buttons) {
 				if(button.first.getGlobalBounds().contains(event.mouseMove.x, event.mouseMove.y)) {
-					if(app_configuration.play_sounds && selected != buttid)
-						selected_option_switch_sound->play();
+					if(selected != buttid)
+						play_sound(selected_option_switch_sound);
 					selected = buttid;
 					break;
 				}
@@ -363,39 +315,81 @@ int main_menu_screen::handle_event(const sf::Event & event) {
 			if(event.joystickButton.button == X360_button_mappings::A)
 				press_button();
 			break;
+
+		case sf::Event::JoystickConnected:
+		case sf::Event::JoystickDisconnected:
+			if(event.joystickConnect.joystickId == 0)
+				try_drawings(event.type == sf::Event::JoystickConnected);
+			break;
 	}
 
 	return 0;
 }
 
+bool main_menu_screen::idle() const {
+	return true;
+}
+
 main_menu_screen::main_menu_screen(application & theapp)
-      : screen(theapp), control_frames_counter(0), joystick_up(false), joystick_drawing(false, drawing("xbox", app.window.getSize())),
+      : screen(theapp), joystick_up(false), joystick_drawing(false, drawing("xbox", app.window.getSize())),
         keys_drawing("keyboard", app.window.getSize()),
-        update(std::future<cpr::Response>(), std::thread(), sf::Text("", font_monospace, 10), app_configuration.use_network),
-        selected_option_switch_sound(
-            audiere::OpenSoundEffect(audio_device, (sound_root + "/main_menu/mouse_over.wav").c_str(), audiere::SoundEffectType::MULTIPLE)),
-        selected_option_unchanged_sound(
-            audiere::OpenSoundEffect(audio_device, (sound_root + "/main_menu/Alt_Fire_Switch.mp3").c_str(), audiere::SoundEffectType::MULTIPLE)),
-        selected_option_select_sound(
-            audiere::OpenSoundEffect(audio_device, (sound_root + "/main_menu/mouse_click.wav").c_str(), audiere::SoundEffectType::MULTIPLE)),
-        update_ready_sound(audiere::OpenSoundEffect(audio_device, (sound_root + "/main_menu/update.wav").c_str(), audiere::SoundEffectType::SINGLE)) {
-	selected_option_switch_sound->setVolume(output_volume(app_configuration.sound_effect_volume * .8));
-	selected_option_unchanged_sound->setVolume(output_volume(app_configuration.sound_effect_volume * .8));
-	selected_option_select_sound->setVolume(output_volume(app_configuration.sound_effect_volume * .8));
-	update_ready_sound->setVolume(output_volume(app_configuration.sound_effect_volume * .8));
+        update(std::future<void>(), sf::Text("", font_monospace, 10)),
+        selected_option_switch_sound(sound_root + "/main_menu/mouse_over.wav"), selected_option_unchanged_sound(sound_root + "/main_menu/Alt_Fire_Switch.mp3"),
+        selected_option_select_sound(sound_root + "/main_menu/mouse_click.wav"), update_ready_sound(sound_root + "/main_menu/update.wav"),
+        decoded_sounds(
+            sound_voices.preload({selected_option_switch_sound, selected_option_unchanged_sound, selected_option_select_sound, update_ready_sound})) {
 
 	if(app_configuration.use_network)
-		std::get<0>(update) =
-		    cpr::GetAsync(cpr::Url("https://api.github.com/repos/nabijaczleweli/BarbersAndRebarbs/releases/latest"), cpr::Parameters{{"anon", "true"}});
+		update.first = background_jobs.submit(job_priority::io, [&, guard = std::weak_ptr<void>(continuation_guard) ] {
+			auto result =
+			    cpr::Get(cpr::Url("https://api.github.com/repos/nabijaczleweli/BarbersAndRebarbs/releases/latest"), cpr::Parameters{{"anon", "true"}});
+			std::cout << result.header["X-RateLimit-Remaining"] << " GitHub API accesses left\n";
+
+			if(!(result.status_code >= 200 && result.status_code < 300))
+				application::post_to_main_thread(guard, [this, status_code = result.status_code ] {
+					update.second.setString(fmt::format(global_iser.translate_key("gui.main_menu.text.update_connection_fail"), status_code));
+				});
+			else {
+				json::value newest_update;
+				json::parse(result.text, newest_update);
+
+				auto new_version_s = newest_update["tag_name"].as<std::string>();
+				new_version_s      = new_version_s.substr(new_version_s.find_first_of("0123456789"));
+
+				if(version::Semver200_version(new_version_s) <= version::Semver200_version(BARBERSANDREBARBS_VERSION))
+					application::post_to_main_thread(
+					    guard, [this] { update.second.setString(global_iser.translate_key("gui.main_menu.text.update_none_found")); });
+				else
+					application::post_to_main_thread(guard, [this, new_version_s, url = newest_update["html_url"].as<std::string>() ] {
+						play_sound(update_ready_sound);
+						update.second.setString(fmt::format(global_iser.translate_key("gui.main_menu.text.update_found"), new_version_s));
+
+						main_buttons.emplace_back(sf::Text(global_iser.translate_key("gui.main_menu.text.update"), font_swirly), [&, url](sf::Text &) {
+							if(!launch_browser(url)) {
+								main_buttons.clear();
+								main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.back"), font_swirly),
+								                           [&](sf::Text &) { set_default_menu_items(); });
+								main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.update_browser_fail_0"), font_pixelish, 20),
+								                           [&](sf::Text &) {});
+								main_buttons.emplace_front(sf::Text(url, font_pixelish, 20), [&](sf::Text & txt) { copy_to_clipboard(txt.getString()); });
+								main_buttons.emplace_front(sf::Text(global_iser.translate_key("gui.main_menu.text.update_browser_fail_1"), font_pixelish, 20),
+								                           [&](sf::Text &) {});
+								selected = main_buttons.size() - 1;
+							}
+						});
+					});
+			}
+		});
 
 	keys_drawing.move(app.window.getSize().x / 4 - keys_drawing.size().x / 2, app.window.getSize().y / 2 - keys_drawing.size().y / 2);
 	joystick_drawing.second.move(app.window.getSize().x / 4 - joystick_drawing.second.size().x / 2,
 	                             app.window.getSize().y / 2 - joystick_drawing.second.size().y / 2);
+	try_drawings(app.input().joystick_connected);
 
 	set_default_menu_items();
 }
 
 main_menu_screen::~main_menu_screen() {
-	if(std::get<1>(update).joinable())
-		std::get<1>(update).join();
+	if(update.first.valid())
+		update.first.wait();
 }
@@ -24,12 +24,16 @@
 
 
 #include "../../../render/drawing.hpp"
+#include "../../../sound/audio_cache.hpp"
 #include "../screen.hpp"
-#include <audiere.h>
 #include <cpr/cpr.h>
 #include <functional>
+#include <future>
 #include <list>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 
 class main_menu_screen : public screen {
@@ -39,19 +43,22 @@ public:
 
 private:
 	std::list<button_clickable> main_buttons;
-	std::size_t selected, control_frames_counter;
+	std::size_t selected;
 	bool joystick_up;
 	std::pair<bool, drawing> joystick_drawing;
 	drawing keys_drawing;
-	std::tuple<std::future<cpr::Response>, std::thread, sf::Text, bool> update;
-	audiere::SoundEffectPtr selected_option_switch_sound;
-	audiere::SoundEffectPtr selected_option_unchanged_sound;
-	audiere::SoundEffectPtr selected_option_select_sound;
-	audiere::SoundEffectPtr update_ready_sound;
+	std::pair<std::future<void>, sf::Text> update;
+	std::string selected_option_switch_sound;
+	std::string selected_option_unchanged_sound;
+	std::string selected_option_select_sound;
+	std::string update_ready_sound;
+	std::vector<audio_cache::handle> decoded_sounds;
+	std::shared_ptr<void> continuation_guard = std::make_shared<char>();
 
+	void play_sound(const std::string & path);
 	void move_selection(direction dir, bool end);
 	void press_button();
-	void try_drawings();
+	void try_drawings(bool joystick_connected);
 	void load_game(sf::Text & txt, const std::string & save_path);
 	void set_default_menu_items();
 	void set_config_menu_items();
@@ -61,6 +68,7 @@ public:
 	virtual int loop() override;
 	virtual int draw() override;
 	virtual int handle_event(const sf::Event & event) override;
+	virtual bool idle() const override;
 
 	main_menu_screen(application & theapp);
 	virtual ~main_menu_screen();
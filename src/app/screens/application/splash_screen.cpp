@@ -28,10 +28,9 @@
 
 void splash_screen::setup() {
 	screen::setup();
-	if(!frames)
-		app.schedule_screen<main_menu_screen>();
+	shown.start(std::chrono::steady_clock::now());
 
-	background.loadFromFile(textures_root + "/gui/main/splash.png");
+	background.loadFromImage(splash_image);
 	const float scale = static_cast<float>(app.window.getSize().y - text.getGlobalBounds().height * 1.5f) / background.getSize().y;
 	background.setScale(scale, scale);
 	background.setPosition(app.window.getSize().x / 2 - background.getGlobalBounds().width / 2, 0);
@@ -40,7 +39,7 @@ void splash_screen::setup() {
 }
 
 int splash_screen::loop() {
-	if(!frames)
+	if(!shown.running(std::chrono::steady_clock::now()))
 		app.schedule_screen<main_menu_screen>();
 	return 0;
 }
@@ -48,8 +47,6 @@ int splash_screen::loop() {
 int splash_screen::draw() {
 	app.window.draw(background);
 	app.window.draw(text);
-
-	--frames;
 	return 0;
 }
 
@@ -62,4 +59,12 @@ int splash_screen::handle_event(const sf::Event & event) {
 	return 0;
 }
 
-splash_screen::splash_screen(application & theapp, unsigned int frame_amt) : screen(theapp), frames(frame_amt), text(app_name, font_pixelish) {}
+bool splash_screen::idle() const {
+	return true;
+}
+
+std::chrono::steady_clock::time_point splash_screen::wake_time() const {
+	return shown.end();
+}
+
+splash_screen::splash_screen(application & theapp, std::chrono::steady_clock::duration len) : screen(theapp), shown(len), text(app_name, font_pixelish) {}
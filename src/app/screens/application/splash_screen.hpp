@@ -24,12 +24,14 @@
 
 
 #include "../../../render/managed_sprite.hpp"
+#include "../../../util/tween.hpp"
 #include "../screen.hpp"
+#include <chrono>
 
 
 class splash_screen : public screen {
 private:
-	unsigned int frames = 0;
+	tween<std::chrono::steady_clock> shown;
 	managed_sprite background;
 	sf::Text text;
 
@@ -38,7 +40,9 @@ public:
 	virtual int loop() override;
 	virtual int draw() override;
 	virtual int handle_event(const sf::Event & event) override;
+	virtual bool idle() const override;
+	virtual std::chrono::steady_clock::time_point wake_time() const override;
 
-	splash_screen(application & theapp, unsigned int frame_amt);
+	splash_screen(application & theapp, std::chrono::steady_clock::duration length);
 	virtual ~splash_screen() = default;
 };
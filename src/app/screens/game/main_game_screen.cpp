@@ -23,13 +23,116 @@
 #include "main_game_screen.hpp"
 #include "../../../game/entity/player.hpp"
 #include "../../../reference/container.hpp"
+#include "../../../util/datetime.hpp"
 #include "../../application.hpp"
+#include <chrono>
+#include <iostream>
+#include <jsonpp/parser.hpp>
+#include <shared_mutex>
+
+
+static bool is_input(const sf::Event & event) {
+	switch(event.type) {
+		case sf::Event::KeyPressed:
+		case sf::Event::KeyReleased:
+		case sf::Event::MouseButtonPressed:
+		case sf::Event::MouseButtonReleased:
+		case sf::Event::JoystickButtonPressed:
+		case sf::Event::JoystickButtonReleased:
+			return true;
+		default:
+			return false;
+	}
+}
 
 
 void main_game_screen::setup_stats() {
-	const auto & plr = dynamic_cast<const player &>(world.ent(player_id));
-	hp_stat          = {sf::Color::Red, plr.health()};
-	energy_stat      = {sf::Color(50, 200, 200), plr.gun_progress()};
+	hp_stat     = {sf::Color::Red, shown_health};
+	energy_stat = {sf::Color(50, 200, 200), shown_gun_depletion};
+}
+
+void main_game_screen::simulate() {
+	const auto & clock = world.clock();
+	auto next_tick     = std::chrono::steady_clock::now();
+
+	while(simulating.load(std::memory_order_relaxed)) {
+		const auto tick_start = std::chrono::steady_clock::now();
+
+		tick_events.clear();
+		std::chrono::steady_clock::time_point input_polled{};
+		std::pair<sf::Event, std::chrono::steady_clock::time_point> event;
+		while(pending_events.pop(event)) {
+			tick_events.emplace_back(event.first);
+			if(is_input(event.first) && (input_polled == std::chrono::steady_clock::time_point{} || event.second < input_polled))
+				input_polled = event.second;
+		}
+
+		if(clock.paused()) {  // Input while paused is dropped, not deferred
+			next_tick = tick_start + clock.tick_length();
+			std::this_thread::sleep_until(next_tick);
+			continue;
+		}
+
+		// Several ticks may run on one frame's input, if they outpace drawing
+		tick_input input;
+		std::uint64_t generation;
+		{
+			std::lock_guard<std::mutex> lock(handoff_lock);
+			input      = published_input;
+			generation = consumed_generation = input_generation;
+		}
+		if(replay && !replay->next_tick(input, tick_events)) {
+			replay_finished = true;
+			break;
+		}
+		if(recorder)
+			recorder->record_tick(input, tick_events);
+
+		{
+			std::shared_lock<std::shared_timed_mutex> properties_lock(firearm::properties_lock());
+			world.tick(world_size, input, tick_events);
+
+			auto & snapshot = snapshots.write_buffer();
+			world.snapshot(snapshot);
+			const auto & plr              = dynamic_cast<const player &>(world.ent(player_id));
+			snapshot.player_health        = plr.health();
+			snapshot.player_gun_depletion = plr.gun_progress();
+			snapshot.input_polled         = input_polled;
+			snapshots.publish();
+		}
+		{
+			std::lock_guard<std::mutex> lock(handoff_lock);
+			ticked_generation = generation;
+		}
+		handoff.notify_all();
+
+		auto now = std::chrono::steady_clock::now();
+		tick_times.record(now - tick_start);
+
+		// In low-latency mode the tick may come up to half a tick early or late, to run as soon as a frame's handed its input over;
+		// slept for at most an unscaled tick at a time, re-reading the scale, so that slow motion ending (say, on regaining focus) takes effect at once
+		const auto low_latency = app_configuration.low_latency;
+		const auto tick_due    = next_tick;
+		const auto scaled_tick = [&] { return std::chrono::duration_cast<std::chrono::steady_clock::duration>(clock.tick_length() / clock.time_scale()); };
+		const auto earliest    = [&] { return tick_due + (low_latency ? scaled_tick() / 2 : scaled_tick()); };
+		while(simulating.load(std::memory_order_relaxed) && now < earliest() && !clock.paused()) {
+			std::this_thread::sleep_until(std::min(earliest(), now + clock.tick_length()));
+			now = std::chrono::steady_clock::now();
+		}
+
+		const auto tick_length = scaled_tick();
+		if(low_latency) {
+			std::unique_lock<std::mutex> lock(handoff_lock);
+			handoff.wait_until(lock, tick_due + tick_length + tick_length / 2,
+			                   [&] { return input_generation != consumed_generation || !simulating.load(std::memory_order_relaxed) || clock.paused(); });
+			now = std::chrono::steady_clock::now();
+		}
+
+		// Shifting a tick doesn't move the ones after it, so dropped frames are caught up on, and game time keeps up with wall time
+		next_tick = tick_due + tick_length;
+		if(next_tick < now - tick_length * 5)  // Don't try to catch up after a long stall
+			next_tick = now;
+	}
 }
 
 void main_game_screen::setup() {
@@ -40,30 +143,132 @@ void main_game_screen::setup() {
 
 	hp_stat.setPosition(winsize.x / 4 - hp_bounds.width / 2, (59.f / 60.f) * winsize.y - hp_bounds.height / 2);
 	energy_stat.setPosition((winsize.x / 4) * 3 - energy_bounds.width / 2, (59.f / 60.f) * winsize.y - energy_bounds.height / 2);
+
+	if(app_configuration.dynamic_resolution)
+		resolution = std::make_unique<dynamic_resolution>(app.window.getSize(), application::effective_FPS(), app_configuration.dynamic_resolution_min_scale,
+		                                                  app_configuration.dynamic_resolution_max_scale);
+
+	if(!app.focused)
+		focus_changed(false);
+
+	simulating        = true;
+	simulation_thread = std::thread(&main_game_screen::simulate, this);
 }
 
 int main_game_screen::loop() {
-	world.tick(app.window.getSize());
+	if(replay_finished)
+		app.window.close();
 	return 0;
 }
 
 int main_game_screen::draw() {
-	world.draw(app.window);
+	frame_times.lap();
+
+	hand_input_over();
+
+	const auto fresh      = snapshots.update();
+	const auto & snapshot = snapshots.read_buffer();
+	shown_health          = snapshot.player_health;
+	shown_gun_depletion   = snapshot.player_gun_depletion;
+	if(fresh && snapshot.input_polled != std::chrono::steady_clock::time_point{})
+		app.input_shown(snapshot.input_polled);
+
+	if(resolution) {
+		renderer.draw(snapshot, resolution->begin());
+		resolution->present(app.window);
+	} else
+		renderer.draw(snapshot, app.window);
+	renderer.draw_labels(snapshot, app.window);
+	world.draw_overlay(app.window);
 	app.window.draw(hp_stat);
 	app.window.draw(energy_stat);
 	return 0;
 }
 
+void main_game_screen::hand_input_over() {
+	std::unique_lock<std::mutex> lock(handoff_lock);
+	published_input       = app.input();
+	const auto generation = ++input_generation;
+	handoff.notify_all();
+
+	// Wait for the tick that takes this input, so the frame shows it, but for no longer than the half a tick it may be shifted by,
+	// so as not to hold drawing up much when it's late
+	const auto & clock = world.clock();
+	if(app_configuration.low_latency && !clock.paused() && !replay_finished)
+		handoff.wait_for(lock, clock.tick_length() / 2, [&] { return ticked_generation >= generation; });
+}
+
+void main_game_screen::focus_changed(bool focus) {
+	if(focus == focused)
+		return;
+	focused = focus;
+
+	auto & clock = world.clock();
+	if(!focus) {
+		if(clock.time_scale() * app_configuration.background_time_scale < game_clock::min_time_scale) {
+			paused_for_background = !clock.paused();
+			clock.paused(true);
+		} else {
+			time_scale_before_background = clock.time_scale();
+			clock.time_scale(time_scale_before_background * app_configuration.background_time_scale);
+		}
+	} else {
+		if(paused_for_background)
+			clock.paused(false);
+		if(time_scale_before_background)
+			clock.time_scale(time_scale_before_background);
+		paused_for_background        = false;
+		time_scale_before_background = 0;
+	}
+}
+
 int main_game_screen::handle_event(const sf::Event & event) {
-	world.handle_event(event);
+	if(event.type == sf::Event::LostFocus || event.type == sf::Event::GainedFocus)
+		focus_changed(event.type == sf::Event::GainedFocus);
+	pending_events.push({event, std::chrono::steady_clock::now()});
 	return screen::handle_event(event);
 }
 
-main_game_screen::main_game_screen(application & theapp) : screen(theapp) {
-	player_id = world.spawn<player>(app.window.getSize());
+main_game_screen::main_game_screen(application & theapp)
+      : screen(theapp), world(application::effective_FPS()), world_size(app.window.getSize()), shown_health(0), shown_gun_depletion(0),
+        focused(true), paused_for_background(false), time_scale_before_background(0), simulating(false), replay_finished(false) {
+	if(app.record_input)
+		recorder = std::make_unique<input_recorder>(world, world_size, "");
+	player_id = world.spawn<player>(world_size);
+	setup_stats();
+}
+
+main_game_screen::main_game_screen(application & theapp, const json::object & save)
+      : screen(theapp), world(save, player_id, application::effective_FPS()), world_size(app.window.getSize()), shown_health(0), shown_gun_depletion(0),
+        focused(true), paused_for_background(false), time_scale_before_background(0), simulating(false), replay_finished(false) {
+	if(app.record_input)
+		recorder = std::make_unique<input_recorder>(world, world_size, json::dump_string(save, {0, json::format_options::minify, 20}));
 	setup_stats();
 }
 
-main_game_screen::main_game_screen(application & theapp, const json::object & save) : screen(theapp), world(save, player_id) {
+main_game_screen::main_game_screen(application & theapp, std::unique_ptr<input_replay> replay_a)
+      : screen(theapp), world(replay_a->master_seed(), replay_a->tick_rate()), world_size(replay_a->world_size()), shown_health(0), shown_gun_depletion(0),
+        focused(true), paused_for_background(false), time_scale_before_background(0), replay(std::move(replay_a)), simulating(false), replay_finished(false) {
+	player_id = replay->populate(world);
 	setup_stats();
 }
+
+main_game_screen::~main_game_screen() {
+	{
+		std::lock_guard<std::mutex> lock(handoff_lock);
+		simulating = false;
+	}
+	handoff.notify_all();
+	if(simulation_thread.joinable())
+		simulation_thread.join();
+
+	if(recorder)
+		recorder->save(recordings_root + '/' + fs_safe_current_datetime() + ".rec");
+
+	if(app.print_stats) {
+		std::cout << frame_times.summary("Frame interval") << '\n' << tick_times.summary("Simulation tick") << '\n' << audio_assets.summary() << '\n'
+		          << sound_voices.summary() << '\n';
+		if(resolution)
+			std::cout << resolution->summary() << '\n';
+	}
+}
@@ -23,13 +23,28 @@
 #pragma once
 
 
+#include "../../../game/input_recording.hpp"
 #include "../../../game/world.hpp"
+#include "../../../game/world_snapshot.hpp"
+#include "../../../render/dynamic_resolution.hpp"
 #include "../../../render/managed_sprite.hpp"
 #include "../../../render/stat_bar.hpp"
+#include "../../../render/world_renderer.hpp"
+#include "../../../util/mpsc_queue.hpp"
+#include "../../../util/timing_stats.hpp"
+#include "../../../util/triple_buffer.hpp"
 #include "../screen.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <jsonpp/value.hpp>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 
 class main_game_screen : public screen {
@@ -37,8 +52,41 @@ private:
 	stat_bar hp_stat, energy_stat;
 	game_world world;
 	std::size_t player_id;
+	sf::Vector2u world_size;
+
+	float shown_health;
+	float shown_gun_depletion;
+	world_renderer renderer;
+	std::unique_ptr<dynamic_resolution> resolution;
+	timing_stats frame_times;
+	timing_stats tick_times;
+
+	// What losing focus did to the clock, undone on regaining it; repeated focus events are ignored
+	bool focused;
+	bool paused_for_background;
+	float time_scale_before_background;
+
+	// Owned by the simulation thread from its start to its join
+	triple_buffer<world_snapshot> snapshots;
+	// Input handed over by the main thread once per frame, and which handover the simulation thread's last taken and ticked on
+	std::mutex handoff_lock;
+	std::condition_variable handoff;
+	tick_input published_input{};
+	std::uint64_t input_generation    = 0;
+	std::uint64_t consumed_generation = 0;
+	std::uint64_t ticked_generation   = 0;
+	mpsc_queue<std::pair<sf::Event, std::chrono::steady_clock::time_point>> pending_events;
+	std::vector<sf::Event> tick_events;
+	std::unique_ptr<input_recorder> recorder;
+	std::unique_ptr<input_replay> replay;
+	std::atomic<bool> simulating;
+	std::atomic<bool> replay_finished;
+	std::thread simulation_thread;
 
 	void setup_stats();
+	void simulate();
+	void focus_changed(bool focus);
+	void hand_input_over();
 
 public:
 	virtual void setup() override;
@@ -48,5 +96,6 @@ public:
 
 	main_game_screen(application & theapp);
 	main_game_screen(application & theapp, const json::object & save);
-	virtual ~main_game_screen() = default;
+	main_game_screen(application & theapp, std::unique_ptr<input_replay> replay);
+	virtual ~main_game_screen();
 };
@@ -38,8 +38,9 @@ int screen::handle_event(const sf::Event & event) {
 		sf::Texture txtr;
 		txtr.create(wsize.x, wsize.y);
 		txtr.update(app.window);
-		screenshot_threads.emplace_back([&](auto img) { img.saveToFile(screenshots_root + '/' + fs_safe_current_datetime() + ".png"); }, txtr.copyToImage());
-		screenshot_threads.back().detach();
+		background_jobs.submit(job_priority::io, [img = txtr.copyToImage(), fname = fs_safe_current_datetime() ] {
+			img.saveToFile(screenshots_root + '/' + fname + ".png");
+		});
 	} else if(event.type == sf::Event::MouseButtonPressed)
 		app.window.requestFocus();
 	else if(event.type == sf::Event::Count)
@@ -47,10 +48,12 @@ int screen::handle_event(const sf::Event & event) {
 	return 0;
 }
 
-screen::screen(application & theapp) : app(theapp) {}
+bool screen::idle() const {
+	return false;
+}
 
-screen::~screen() {
-	for(auto && thr : screenshot_threads)
-		if(thr.joinable())
-			thr.join();
+std::chrono::steady_clock::time_point screen::wake_time() const {
+	return std::chrono::steady_clock::time_point::max();
 }
+
+screen::screen(application & theapp) : app(theapp) {}
@@ -24,14 +24,11 @@
 
 
 #include <SFML/Graphics.hpp>
-#include <thread>
+#include <chrono>
 
 
 class application;
 class screen {
-private:
-	std::vector<std::thread> screenshot_threads;
-
 protected:
 	application & app;
 
@@ -41,6 +38,12 @@ public:
 	virtual int draw() = 0;
 	virtual int handle_event(const sf::Event & event);
 
+	/// Whether the screen would look the same if drawn again, barring events, main thread continuations, and wake_time();
+	/// the application then stops redrawing it and dozes until one of those
+	virtual bool idle() const;
+	/// When an idle screen needs to be looped and drawn again regardless
+	virtual std::chrono::steady_clock::time_point wake_time() const;
+
 	screen(application & theapp);
-	virtual ~screen();
+	virtual ~screen() = default;
 };
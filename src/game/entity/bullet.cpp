@@ -25,9 +25,10 @@
 #include "../../reference/joystick_info.hpp"
 #include "../../util/vector.hpp"
 #include "../world.hpp"
+#include "../world_snapshot.hpp"
 #include <SFML/Window.hpp>
 #include <cmath>
-#include <seed11/seed11.hpp>
+#include <random>
 
 
 std::unique_ptr<bullet> bullet::create(game_world & world, size_t id, sf::Vector2f aim, unsigned int x, unsigned int y, const bullet_properties & props) {
@@ -40,8 +41,8 @@ std::unique_ptr<bullet> bullet::create(game_world & world, size_t id, sf::Vector
 std::unique_ptr<bullet> bullet::create(game_world & world, size_t id, sf::Vector2f aim, unsigned int x, unsigned int y, float spread_min, float spread_max,
                                        const bullet_properties & props) {
 	static const auto pi = std::acos(-1.l);
-	static auto rand     = seed11::make_seeded<std::mt19937>();
-	static std::bernoulli_distribution dev_way_dist;
+	auto & rand          = world.random();
+	std::bernoulli_distribution dev_way_dist;
 
 	aim              = normalised(aim);
 	double aim_angle = std::atan2(aim.x, aim.y) * 180. / pi;
@@ -58,14 +59,6 @@ std::unique_ptr<bullet> bullet::create(game_world & world, size_t id, sf::Vector
 	return create(world, id, aim, x, y, props);
 }
 
-void bullet::draw(sf::RenderTarget & target, sf::RenderStates states) const {
-	static const auto constexpr k = 2.5f;
-
-	const sf::Vertex vertices[]{{{x, y}, sf::Color::White},  //
-	                            {{x + motion_x * k, y + motion_y * k}, sf::Color::White}};
-	target.draw(vertices, sizeof vertices / sizeof *vertices, sf::PrimitiveType::Lines, states);
-}
-
 bullet::bullet(game_world & world_r, size_t id_a, unsigned int px, unsigned int py, const bullet_properties & pprops) : entity(world_r, id_a), props(pprops) {
 	x = px;
 	y = py;
@@ -96,6 +89,10 @@ void bullet::tick(float max_x, float max_y) {
 		world.despawn(id);
 }
 
+void bullet::snapshot(world_snapshot & into) const {
+	into.bullets.push_back({x, y, motion_x, motion_y});
+}
+
 float bullet::speed() const {
 	return props.speed;
 }
@@ -25,13 +25,10 @@
 
 #include "../firearm/firearm_properties.hpp"
 #include "entity.hpp"
-#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
 
 
-class bullet : public entity, public sf::Drawable {
-protected:
-	virtual void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
-
+class bullet : public entity {
 private:
 	bullet_properties props;
 
@@ -50,6 +47,7 @@ public:
 
 
 	virtual void tick(float max_x = 0, float max_y = 0) override;
+	virtual void snapshot(world_snapshot & into) const override;
 
 	virtual float speed() const override;
 	virtual float speed_loss() const override;
@@ -99,6 +99,8 @@ void entity::tick(float max_x, float max_y) {
 	}
 }
 
+void entity::snapshot(world_snapshot &) const {}
+
 void entity::start_movement(float amt_x, float amt_y) {
 	const auto spd = speed();
 	motion_x += amt_x * spd;
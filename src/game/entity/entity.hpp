@@ -29,6 +29,7 @@
 
 
 class game_world;
+struct world_snapshot;
 class entity {
 protected:
 	float x, y;
@@ -51,6 +52,7 @@ public:
 	virtual json::object write_to_json() const;
 
 	virtual void tick(float max_x = 0, float max_y = 0);  // maxes for physics
+	virtual void snapshot(world_snapshot & into) const;
 
 
 	void start_movement(float amt_x, float amt_y);
@@ -21,123 +21,62 @@
 
 
 #include "player.hpp"
-#include "../../app/application.hpp"
 #include "../../reference/container.hpp"
 #include "../../reference/joystick_info.hpp"
 #include "../../util/sound.hpp"
 #include "../world.hpp"
+#include "../world_snapshot.hpp"
 #include "bullet.hpp"
 #include <SFML/Window.hpp>
+#include <algorithm>
+#include <chrono>
 #include <random>
-#include <seed11/seed11.hpp>
 
 
-static const sf::Color progress_colour(255, 255, 255, 100);
 static const char * gun_pickup_fnames[]{"gear_rattle02.wav", "gear_rattle03.wav", "gear_rattle05.wav"};
 
-static std::vector<audiere::SoundEffectPtr> open_pickup_sounds() {
-	std::vector<audiere::SoundEffectPtr> out;
+static std::vector<std::string> open_pickup_sounds() {
+	std::vector<std::string> out;
 	out.reserve(sizeof gun_pickup_fnames / sizeof *gun_pickup_fnames);
-	std::transform(std::begin(gun_pickup_fnames), std::end(gun_pickup_fnames), std::back_inserter(out),
-	               [](auto fname) { return audiere::OpenSoundEffect(audio_device, (sound_root + '/' + fname).c_str(), audiere::SoundEffectType::SINGLE); });
-	std::for_each(out.begin(), out.end(), [](auto && sound) { sound->setVolume(output_volume(app_configuration.sound_effect_volume)); });
+	std::transform(std::begin(gun_pickup_fnames), std::end(gun_pickup_fnames), std::back_inserter(out), [](auto fname) { return sound_root + '/' + fname; });
 	return out;
 }
 
 
-std::pair<bool, sf::Vector2f> player::controller_aim(unsigned int controller_id) const {
-	const auto horizontal      = sf::Joystick::getAxisPosition(controller_id, X360_axis_mappings::RightStickHorizontal);
-	const auto vertical        = sf::Joystick::getAxisPosition(controller_id, X360_axis_mappings::RightStickVertical);
+std::pair<bool, sf::Vector2f> player::controller_aim() const {
+	const auto horizontal      = world.input().right_stick.x;
+	const auto vertical        = world.input().right_stick.y;
 	const auto out_of_deadzone = std::abs(horizontal) > app_configuration.controller_deadzone && std::abs(vertical) > app_configuration.controller_deadzone;
 
 	return {out_of_deadzone, {horizontal, vertical}};
 }
 
 
-void player::draw(sf::RenderTarget & target, sf::RenderStates states) const {
-	static const sf::Color body_colour(231, 158, 109);
-	static const sf::Color armour_colour(200, 200, 200);
-
-	const sf::Vertex vertices[]{
-	    {{x - 1, y}, body_colour},        //
-	    {{x, y - 1}, body_colour},        //
-	    {{x + 1, y}, body_colour},        //
-	    {{x, y + 1}, body_colour},        //
-	    {{x - 2, y - 2}, armour_colour},  //
-	    {{x + 2, y - 2}, armour_colour},  //
-	    {{x + 2, y + 2}, armour_colour},  //
-	    {{x - 2, y + 2}, armour_colour},  //
-	};
-
-	// The current/"local" rotation is calculated as follows:
-	//   popup_frames_shown = popup_length - popup_frames_left
-	//   popup_progress ∈ [0..1] = popup_frames_shown / popup_length
-	//   rot ∈ [0..360] = -(popup_progress²) + 1
-	//
-	// In other words, it's an inverted parabola in [0..1].
-	auto rot_state = states;
-	if(gun_name_popup.first) {
-		const auto full_length = application::effective_FPS() * app_configuration.player_gun_popup_length;
-		const auto rot         = gun_name_popup.first / static_cast<double>(full_length);
-		rot_state.transform.rotate(360. * (1. - (rot * rot)), x, y);
-	}
-	target.draw(vertices, sizeof vertices / sizeof *vertices, sf::PrimitiveType::Points, rot_state);
-
-	const auto gun_progress = gun.progress();
-	if(gun_progress != 1) {
-		progress_circle.fraction(gun_progress);
-		progress_circle.setPosition(x, y);
-		progress_circle.setRotation(gun_progress * 360);
-		target.draw(progress_circle, states);
-	}
-	progress = gun.depletion();
-
-	if(gun_name_popup.first) {
-		const auto eff_ps             = application::effective_FPS();
-		const auto full_length        = eff_ps * app_configuration.player_gun_popup_length;
-		const auto in_out_threshold   = eff_ps / 2;
-		const auto fade_in_threshold  = full_length - in_out_threshold;
-		const auto fade_out_threshold = in_out_threshold;
-
-		if(gun_name_popup.first >= fade_in_threshold || gun_name_popup.first <= fade_out_threshold) {
-			auto colour = gun_name_popup.second.getFillColor();
-			if(gun_name_popup.first >= fade_in_threshold)
-				colour.a = 255 * (1.f - (static_cast<float>(gun_name_popup.first - fade_in_threshold) / in_out_threshold));
-			else if(gun_name_popup.first <= fade_out_threshold)
-				colour.a = 255 * (static_cast<float>(gun_name_popup.first) / in_out_threshold);
-			gun_name_popup.second.setFillColor(colour);
-		}
-
-		const auto & size = gun_name_popup.second.getLocalBounds();
-		gun_name_popup.second.setPosition(x - size.width / 2., y - size.height * 2);
-
-		target.draw(gun_name_popup.second);
-
-		if(gun_name_popup.first == full_length) {
-			if(app_configuration.play_sounds)
-				gun_pickup_sounds.second[gun_pickup_sounds.first]->play();
-			if(++gun_pickup_sounds.first >= gun_pickup_sounds.second.size())
-				gun_pickup_sounds.first = 0;
-		}
+void player::snapshot(world_snapshot & into) const {
+	// The popup spins a full turn, quickly at first and slowing down towards the end,
+	// fading in over the first half-second and out over the last one.
+	const auto now  = world.clock().now();
+	const auto edge = .5f / app_configuration.player_gun_popup_length;
 
-		--gun_name_popup.first;
+	auto rotation   = 0.f;
+	sf::Uint8 alpha = 255;
+	if(gun_name_popup.running(now)) {
+		rotation = 360.f * easing::quadratic_out(gun_name_popup.progress(now));
+		alpha    = 255 * std::min(gun_name_popup.progress(now, 0, edge), 1.f - gun_name_popup.progress(now, 1.f - edge, 1));
 	}
+
+	into.players.push_back({x, y, rotation, gun.progress(), gun_name_popup.running(now), alpha, gun.name()});
 }
 
 player::player(game_world & world_r)
-      : entity(world_r), progress_circle(0, 7), frames_pressed(0),
-        gun_name_popup(application::effective_FPS() * app_configuration.player_gun_popup_length, {"", font_pixelish, 10}),
-        gun_pickup_sounds(0, open_pickup_sounds()) {
-	progress_circle.colour(progress_colour);
-}
+      : entity(world_r), frames_pressed(0), progress(0), gun_name_popup(std::chrono::seconds(app_configuration.player_gun_popup_length)),
+        gun_pickup_sounds(0, open_pickup_sounds()), decoded_pickup_sounds(sound_voices.preload(gun_pickup_sounds.second)) {}
 
 player::player(game_world & world_r, size_t id_a, sf::Vector2u screen_size)
-      : entity(world_r, id_a), progress_circle(0, 7), gun(world_r, app_configuration.player_default_firearm), hp(1), frames_pressed(0), progress(0),
-        gun_name_popup(application::effective_FPS() * app_configuration.player_gun_popup_length, {gun.name(), font_pixelish, 10}),
-        gun_pickup_sounds(0, open_pickup_sounds()) {
-	static auto rand = seed11::make_seeded<std::mt19937>();
-
-	progress_circle.colour(progress_colour);
+      : entity(world_r, id_a), gun(world_r, app_configuration.player_default_firearm), hp(1), frames_pressed(0), progress(0),
+        gun_name_popup(std::chrono::seconds(app_configuration.player_gun_popup_length)), gun_pickup_sounds(0, open_pickup_sounds()),
+        decoded_pickup_sounds(sound_voices.preload(gun_pickup_sounds.second)) {
+	auto & rand = world.random();
 
 	std::uniform_real_distribution<float> x_dist(0, screen_size.x - 1);
 	std::uniform_real_distribution<float> y_dist(0, screen_size.y - 1);
@@ -155,8 +94,6 @@ void player::read_from_json(const json::object & from) {
 		gun = firearm(world, itr->second.as<json::object>());
 	if((itr = from.find("hp")) != from.end())
 		hp = itr->second.as<float>();
-
-	gun_name_popup.second.setString(gun.name());
 }
 
 json::object player::write_to_json() const {
@@ -168,35 +105,35 @@ json::object player::write_to_json() const {
 }
 
 void player::tick(float max_x, float max_y) {
-	const auto joystick_connected = sf::Joystick::isConnected(0);
+	const auto & input = world.input();
 
 	entity::tick(max_x, max_y);
-	gun.tick(x, y, static_cast<sf::Vector2f>(sf::Mouse::getPosition()) - sf::Vector2f(x, y));
+	gun.tick(x, y, static_cast<sf::Vector2f>(input.mouse) - sf::Vector2f(x, y));
 
 	auto delta_speed_x = 0.f;
 	auto delta_speed_y = 0.f;
 	auto any_pressed   = false;
 
-	if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) {
+	if(input.left) {
 		any_pressed = true;
 		delta_speed_x -= 1;
 	}
-	if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) {
+	if(input.right) {
 		any_pressed = true;
 		delta_speed_x += 1;
 	}
-	if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) {
+	if(input.up) {
 		any_pressed = true;
 		delta_speed_y -= 1;
 	}
-	if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S)) {
+	if(input.down) {
 		any_pressed = true;
 		delta_speed_y += 1;
 	}
 
-	if(joystick_connected) {
-		const auto horizontal = sf::Joystick::getAxisPosition(0, X360_axis_mappings::LeftStickHorizontal);
-		const auto vertical   = sf::Joystick::getAxisPosition(0, X360_axis_mappings::LeftStickVertical);
+	if(input.joystick_connected) {
+		const auto horizontal = input.left_stick.x;
+		const auto vertical   = input.left_stick.y;
 		if(std::abs(horizontal) > app_configuration.controller_deadzone && std::abs(vertical) > app_configuration.controller_deadzone) {
 			const auto horizontal_sign = horizontal / std::abs(horizontal);
 			const auto vertical_sign   = vertical / std::abs(vertical);
@@ -213,27 +150,38 @@ void player::tick(float max_x, float max_y) {
 		else if(frames_pressed)
 			frames_pressed -= 1;
 	} else {
-		const auto frames_to_full_speed = app_configuration.player_seconds_to_full_speed * application::effective_FPS();
+		const auto frames_to_full_speed = app_configuration.player_seconds_to_full_speed / std::chrono::duration<float>(world.clock().tick_length()).count();
 		const auto accel_scaled         = std::min(frames_pressed / frames_to_full_speed, 1.f);
 
 		start_movement(delta_speed_x * accel_scaled, delta_speed_y * accel_scaled);
 		++frames_pressed;
 	}
+
+	if(!gun_name_popup.started()) {
+		gun_name_popup.start(world.clock().now());
+
+		if(app_configuration.play_sounds)
+			sound_voices.play(gun_pickup_sounds.second[gun_pickup_sounds.first], output_volume(app_configuration.sound_effect_volume),
+			                  voice_priority::important, world.clock().now());
+		if(++gun_pickup_sounds.first >= gun_pickup_sounds.second.size())
+			gun_pickup_sounds.first = 0;
+	}
+	progress = gun.depletion();
 }
 
 void player::handle_event(const sf::Event & event) {
 	if(event.type == sf::Event::EventType::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Button::Left)
-		gun.trigger(x, y, static_cast<sf::Vector2f>(sf::Mouse::getPosition()) - sf::Vector2f(x, y));
+		gun.trigger(x, y, sf::Vector2f(event.mouseButton.x, event.mouseButton.y) - sf::Vector2f(x, y));
 	else if(event.type == sf::Event::EventType::JoystickButtonPressed && event.joystickButton.button == X360_button_mappings::RB &&
 	        event.joystickButton.joystickId == 0) {
-		const auto aim = controller_aim(0);
+		const auto aim = controller_aim();
 		if(aim.first)
 			gun.trigger(x, y, aim.second);
 	} else if(event.type == sf::Event::EventType::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Button::Left)
-		gun.untrigger(x, y, static_cast<sf::Vector2f>(sf::Mouse::getPosition()) - sf::Vector2f(x, y));
+		gun.untrigger(x, y, sf::Vector2f(event.mouseButton.x, event.mouseButton.y) - sf::Vector2f(x, y));
 	else if(event.type == sf::Event::EventType::JoystickButtonReleased && event.joystickButton.button == X360_button_mappings::RB &&
 	        event.joystickButton.joystickId == 0) {
-		const auto aim = controller_aim(0);
+		const auto aim = controller_aim();
 		if(aim.first)
 			gun.untrigger(x, y, aim.second);
 	} else if((event.type == sf::Event::EventType::KeyPressed && event.key.code == sf::Keyboard::Key::R) ||
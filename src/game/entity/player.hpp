@@ -23,29 +23,28 @@
 #pragma once
 
 
-#include "../../render/circle_chunk.hpp"
+#include "../../sound/audio_cache.hpp"
+#include "../../util/tween.hpp"
 #include "../firearm/firearm.hpp"
+#include "../game_clock.hpp"
 #include "entity.hpp"
 #include "event_handler.hpp"
-#include <SFML/Graphics.hpp>
-#include <audiere.h>
+#include <SFML/System.hpp>
 
 
-class player : public entity, public event_handler, public sf::Drawable {
+class player : public entity, public event_handler {
 protected:
-	virtual void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
-
-	std::pair<bool, sf::Vector2f> controller_aim(unsigned int controller_id) const;
+	std::pair<bool, sf::Vector2f> controller_aim() const;
 	void create_gun_name_popup();
 
 private:
-	mutable circle_chunk progress_circle;
 	firearm gun;
 	float hp;
 	std::size_t frames_pressed;
-	mutable float progress;
-	mutable std::pair<unsigned int, sf::Text> gun_name_popup;
-	mutable std::pair<std::size_t, std::vector<audiere::SoundEffectPtr>> gun_pickup_sounds;
+	float progress;
+	tween<game_clock> gun_name_popup;
+	std::pair<std::size_t, std::vector<std::string>> gun_pickup_sounds;
+	std::vector<audio_cache::handle> decoded_pickup_sounds;
 
 public:
 	player(game_world & world);
@@ -57,6 +56,7 @@ public:
 	virtual json::object write_to_json() const override;
 
 	virtual void tick(float max_x, float max_y) override;
+	virtual void snapshot(world_snapshot & into) const override;
 	virtual void handle_event(const sf::Event & event) override;
 
 	virtual float speed() const override;
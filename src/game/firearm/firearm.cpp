@@ -31,47 +31,48 @@
 using namespace std::literals;
 
 
-static std::vector<audiere::SoundEffectPtr> open_shoot_sounds(const std::vector<std::string> & fnames) {
-	std::vector<audiere::SoundEffectPtr> out;
+static std::vector<std::string> open_shoot_sounds(const std::vector<std::string> & fnames) {
+	std::vector<std::string> out;
 	out.reserve(fnames.size());
-	std::transform(fnames.begin(), fnames.end(), std::back_inserter(out), [](auto && fname) {
-		return audiere::OpenSoundEffect(audio_device, (sound_root + "/guns/" + fname).c_str(), audiere::SoundEffectType::MULTIPLE);
-	});
-
-	std::for_each(out.begin(), out.end(), [](auto && sound) { sound->setVolume(output_volume(app_configuration.sound_effect_volume * .7)); });
+	std::transform(fnames.begin(), fnames.end(), std::back_inserter(out), [](auto && fname) { return sound_root + "/guns/" + fname; });
 	return out;
 }
 
-void firearm::fire(std::chrono::time_point<std::chrono::high_resolution_clock> now, float pos_x, float pos_y, const sf::Vector2f & aim) {
-	for(auto bid = 0u; bid < props->projectiles_per_shot; ++bid)
-		if(props->spread.first)
-			world->spawn_create<bullet>(aim, pos_x, pos_y, props->spread.second.min, props->spread.second.max, std::cref(props->bullet_props));
+const firearm_properties & firearm::props() const noexcept {
+	return properties()[props_id];
+}
+
+void firearm::fire(game_clock::time_point now, float pos_x, float pos_y, const sf::Vector2f & aim) {
+	for(auto bid = 0u; bid < props().projectiles_per_shot; ++bid)
+		if(props().spread.first)
+			world->spawn_create<bullet>(aim, pos_x, pos_y, props().spread.second.min, props().spread.second.max, std::cref(props().bullet_props));
 		else
-			world->spawn_create<bullet>(aim, pos_x, pos_y, std::cref(props->bullet_props));
+			world->spawn_create<bullet>(aim, pos_x, pos_y, std::cref(props().bullet_props));
 
 	if(app_configuration.play_sounds && !shoot_sounds.empty()) {
 		if(last_shoot_sound == shoot_sounds.size() - 1)
 			last_shoot_sound = 0;
 		else
 			++last_shoot_sound;
-		shoot_sounds[last_shoot_sound]->play();
+		sound_voices.play(shoot_sounds[last_shoot_sound], output_volume(app_configuration.sound_effect_volume * .7), voice_priority::effect, now);
 	}
 	action_repeat_start = now;
 	--left_in_mag;
 }
 
-firearm::firearm() : props(nullptr), world(nullptr) {}
+firearm::firearm() : props_id(0), world(nullptr), clock(nullptr) {}
 
 firearm::firearm(game_world & w, const std::string & gun_id)
-      : props(&properties().at(gun_id)), world(&w),
-        action_speed(std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
-            std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(props->action_speed * std::micro::den)))),
-        reload_speed(std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
-            std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(props->reload_speed * std::micro::den)))),
-        trigger_pulled(false), left_in_mag(0), left_mags(props->mag_quantity), shoot_sounds(open_shoot_sounds(props->shoot_sounds)), last_shoot_sound(0),
-        reload_sound(audiere::OpenSoundEffect(audio_device, (sound_root + "/guns/" + props->reload_sound).c_str(), audiere::SoundEffectType::SINGLE)) {
-	if(reload_sound)
-		reload_sound->setVolume(output_volume(app_configuration.sound_effect_volume * .7));
+      : props_id(id_of(gun_id)), world(&w), clock(&w.clock()),
+        action_speed(std::chrono::duration_cast<game_clock::duration>(
+            std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(props().action_speed * std::micro::den)))),
+        reload_speed(std::chrono::duration_cast<game_clock::duration>(
+            std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(props().reload_speed * std::micro::den)))),
+        action_repeat_start(clock->now() - action_speed), mag_reload_start(clock->now() - reload_speed), trigger_pulled(false), left_in_mag(0),
+        left_mags(props().mag_quantity), shoot_sounds(open_shoot_sounds(props().shoot_sounds)), last_shoot_sound(0),
+        reload_sound(props().reload_sound.empty() ? "" : sound_root + "/guns/" + props().reload_sound), decoded_sounds(sound_voices.preload(shoot_sounds)) {
+	if(!reload_sound.empty())
+		decoded_sounds.emplace_back(sound_voices.preload(reload_sound));
 }
 
 firearm::firearm(game_world & w, const json::object & from) : firearm(w, json_get_defaulted(from, "id", "default"s)) {
@@ -90,7 +91,7 @@ void firearm::read_from_json(const json::object & from) {
 
 json::object firearm::write_to_json() const {
 	return {
-	    {"id", props->id},                   //
+	    {"id", props().id},                  //
 	    {"trigger_pulled", trigger_pulled},  //
 	    {"left_in_mag", left_in_mag},        //
 	    {"left_mags", left_mags},            //
@@ -98,7 +99,7 @@ json::object firearm::write_to_json() const {
 }
 
 void firearm::trigger(float pos_x, float pos_y, const sf::Vector2f & aim) {
-	const auto now          = std::chrono::high_resolution_clock::now();
+	const auto now          = clock->now();
 	const auto action_ready = now - action_repeat_start >= action_speed;
 	const auto reload_ready = now - mag_reload_start >= reload_speed;
 	const auto shoot        = action_ready && reload_ready && left_in_mag;
@@ -110,10 +111,10 @@ void firearm::trigger(float pos_x, float pos_y, const sf::Vector2f & aim) {
 }
 
 void firearm::tick(float pos_x, float pos_y, const sf::Vector2f & aim) {
-	const auto shoot = trigger_pulled && left_in_mag && props->fire_mode == firearm_properties::fire_mode_t::full_auto;
+	const auto shoot = trigger_pulled && left_in_mag && props().fire_mode == firearm_properties::fire_mode_t::full_auto;
 
 	if(shoot) {
-		const auto now          = std::chrono::high_resolution_clock::now();
+		const auto now          = clock->now();
 		const auto action_ready = now - action_repeat_start >= action_speed;
 		const auto reload_ready = now - mag_reload_start >= reload_speed;
 
@@ -123,12 +124,12 @@ void firearm::tick(float pos_x, float pos_y, const sf::Vector2f & aim) {
 }
 
 void firearm::untrigger(float pos_x, float pos_y, const sf::Vector2f & aim) {
-	const auto shoot = left_in_mag && props->fire_mode == firearm_properties::fire_mode_t::semi_auto_response_trigger;
+	const auto shoot = left_in_mag && props().fire_mode == firearm_properties::fire_mode_t::semi_auto_response_trigger;
 
 	trigger_pulled = false;
 
 	if(shoot) {
-		const auto now          = std::chrono::high_resolution_clock::now();
+		const auto now          = clock->now();
 		const auto action_ready = now - action_repeat_start >= action_speed;
 		const auto reload_ready = now - mag_reload_start >= reload_speed;
 
@@ -139,25 +140,25 @@ void firearm::untrigger(float pos_x, float pos_y, const sf::Vector2f & aim) {
 
 void firearm::reload() {
 	if(left_mags) {
-		if(app_configuration.play_sounds && reload_sound)
-			reload_sound->play();
-		left_in_mag      = props->mag_size;
-		mag_reload_start = std::chrono::high_resolution_clock::now();
+		if(app_configuration.play_sounds && !reload_sound.empty())
+			sound_voices.play(reload_sound, output_volume(app_configuration.sound_effect_volume * .7), voice_priority::important, clock->now());
+		left_in_mag      = props().mag_size;
+		mag_reload_start = clock->now();
 		--left_mags;
 	} else
 		left_in_mag = 0;
 }
 
 const std::string & firearm::id() const noexcept {
-	return props->id;
+	return props().id;
 }
 
 const std::string & firearm::name() const noexcept {
-	return props->name;
+	return props().name;
 }
 
 float firearm::progress() const noexcept {
-	const auto now             = std::chrono::high_resolution_clock::now();
+	const auto now             = clock->now();
 	const auto reload_progress = (now - mag_reload_start).count() / static_cast<double>(reload_speed.count());
 
 	if(reload_progress >= 1) {
@@ -168,10 +169,10 @@ float firearm::progress() const noexcept {
 }
 
 float firearm::depletion() const noexcept {
-	const auto now          = std::chrono::high_resolution_clock::now();
+	const auto now          = clock->now();
 	const auto reload_ready = now - mag_reload_start >= reload_speed;
 	if(reload_ready) {
-		return left_in_mag / static_cast<float>(props->mag_size);
+		return left_in_mag / static_cast<float>(props().mag_size);
 	} else
-		return left_mags / static_cast<float>(props->mag_quantity);
+		return left_mags / static_cast<float>(props().mag_quantity);
 }
@@ -23,38 +23,52 @@
 #pragma once
 
 
+#include "../../sound/audio_cache.hpp"
+#include "../game_clock.hpp"
 #include "../world.hpp"
 #include "firearm_properties.hpp"
 #include <SFML/System.hpp>
-#include <audiere.h>
 #include <chrono>
 #include <jsonpp/value.hpp>
-#include <map>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 
 
 class firearm {
 private:
-	const firearm_properties * props;
+	std::size_t props_id;
 	game_world * world;
-	/*const*/ std::chrono::high_resolution_clock::duration action_speed;
-	/*const*/ std::chrono::high_resolution_clock::duration reload_speed;
+	const game_clock * clock;
+	/*const*/ game_clock::duration action_speed;
+	/*const*/ game_clock::duration reload_speed;
 
-	std::chrono::high_resolution_clock::time_point action_repeat_start;
-	std::chrono::high_resolution_clock::time_point mag_reload_start;
+	game_clock::time_point action_repeat_start;
+	game_clock::time_point mag_reload_start;
 	bool trigger_pulled;
 	unsigned int left_in_mag;
 	unsigned int left_mags;
 
-	std::vector<audiere::SoundEffectPtr> shoot_sounds;
+	std::vector<std::string> shoot_sounds;
 	std::size_t last_shoot_sound;
-	audiere::SoundEffectPtr reload_sound;
+	std::string reload_sound;
+	std::vector<audio_cache::handle> decoded_sounds;
 
 
-	void fire(std::chrono::time_point<std::chrono::high_resolution_clock> now, float pos_x, float pos_y, const sf::Vector2f & aim);
+	const firearm_properties & props() const noexcept;
+	void fire(game_clock::time_point now, float pos_x, float pos_y, const sf::Vector2f & aim);
 
 public:
-	static const std::map<std::string, firearm_properties> & properties();
+	/// Every gun, loaded once on first use and sorted by ID, followed by any new ones replace_properties() has added since
+	static const std::vector<firearm_properties> & properties();
+	/// Index of the specified gun into properties(), throws std::out_of_range for unknown guns
+	static std::size_t id_of(const std::string & gun_id);
+	/// Held shared by the simulation thread while it ticks, exclusively by replace_properties()
+	static std::shared_timed_mutex & properties_lock();
+	/// Parse a single gun file, throws on malformed ones
+	static firearm_properties load_properties(const std::string & filename);
+	/// Swap in freshly loaded properties, live firearms with the same ID pick them up
+	static void replace_properties(firearm_properties props);
 
 
 	firearm();
@@ -21,36 +21,76 @@
 
 
 #include "../../reference/container.hpp"
-#include "../../util/file.hpp"
 #include "firearm.hpp"
-#include <fstream>
+#include <algorithm>
 #include <jsonpp/parser.hpp>
 #include <stdexcept>
+#include <unordered_map>
 
 
-static std::map<std::string, firearm_properties> all_firearm_properties;
+static std::vector<firearm_properties> load_all();
+static firearm_properties load_single(std::string && filename);
+static firearm_properties::fire_mode_t fire_mode_from_string(const std::string & name);
 
 
-static void load_all(std::map<std::string, firearm_properties> & all_props);
-static std::pair<std::string, firearm_properties> load_single(std::string && filename);
-static firearm_properties::fire_mode_t fire_mode_from_string(const std::string & name);
+static std::pair<std::vector<firearm_properties>, std::unordered_map<std::string, std::size_t>> & all_firearm_properties() {
+	static auto all = [] {
+		std::pair<std::vector<firearm_properties>, std::unordered_map<std::string, std::size_t>> ret;
+		ret.first = load_all();
+		ret.second.reserve(ret.first.size());
+		for(auto i = 0u; i < ret.first.size(); ++i)
+			ret.second.emplace(ret.first[i].id, i);
+		return ret;
+	}();
+	return all;
+}
 
+const std::vector<firearm_properties> & firearm::properties() {
+	return all_firearm_properties().first;
+}
 
-const std::map<std::string, firearm_properties> & firearm::properties() {
-	load_all(all_firearm_properties);
-	return all_firearm_properties;
+std::size_t firearm::id_of(const std::string & gun_id) {
+	return all_firearm_properties().second.at(gun_id);
 }
 
+std::shared_timed_mutex & firearm::properties_lock() {
+	static std::shared_timed_mutex lock;
+	return lock;
+}
+
+firearm_properties firearm::load_properties(const std::string & filename) {
+	return load_single(std::string(filename));
+}
+
+void firearm::replace_properties(firearm_properties props) {
+	std::lock_guard<std::shared_timed_mutex> lock(properties_lock());
+	auto & all = all_firearm_properties();
+
+	const auto itr = all.second.find(props.id);
+	if(itr != all.second.end())
+		all.first[itr->second] = std::move(props);
+	else {  // Appended, since existing firearms hold indices into the table
+		all.second.emplace(props.id, all.first.size());
+		all.first.emplace_back(std::move(props));
+	}
+}
+
+
+static std::vector<firearm_properties> load_all() {
+	std::vector<firearm_properties> all_props;
+	for(auto && fname : packed_assets.list(firearm_root))
+		all_props.emplace_back(load_single(firearm_root + '/' + fname));
 
-static void load_all(std::map<std::string, firearm_properties> & all_props) {
-	for(auto && fname : list_files(firearm_root))
-		all_props.insert(load_single(firearm_root + '/' + fname));
+	// Sorted by ID with the first-listed duplicate winning, as they used to be in a map
+	std::stable_sort(all_props.begin(), all_props.end(), [](auto && lhs, auto && rhs) { return lhs.id < rhs.id; });
+	all_props.erase(std::unique(all_props.begin(), all_props.end(), [](auto && lhs, auto && rhs) { return lhs.id == rhs.id; }), all_props.end());
+	all_props.shrink_to_fit();
+	return all_props;
 }
 
-static std::pair<std::string, firearm_properties> load_single(std::string && filename) {
-	std::ifstream gun_file(filename);
+static firearm_properties load_single(std::string && filename) {
 	json::value doc;
-	json::parse(gun_file, doc);
+	json::parse(packed_assets.read(filename), doc);
 
 	auto && sounds_v = doc["sounds"];
 	std::vector<json::value> raw_sounds;
@@ -82,25 +122,24 @@ static std::pair<std::string, firearm_properties> load_single(std::string && fil
 	auto bullet   = doc["bullet"].as<json::object>();
 	const auto id = doc["id"].as<std::string>();
 	return {id,
-	        {id,
-	         doc["name"].as<std::string>(),
+	        doc["name"].as<std::string>(),
+	        {
+	            bullet["speed"].as<float>(),  //
+	            bullet["speed_loss"].as<float>(),
+	        },
+	        fire_mode_from_string(doc["fire_mode"].as<std::string>()),
+	        doc["action_speed"].as<float>(),
+	        doc["reload_speed"].as<float>(),
+	        doc["mag_size"].as<unsigned int>(),
+	        doc["mag_quantity"].as<unsigned int>(),
+	        {have_spread,
 	         {
-	             bullet["speed"].as<float>(),  //
-	             bullet["speed_loss"].as<float>(),
-	         },
-	         fire_mode_from_string(doc["fire_mode"].as<std::string>()),
-	         doc["action_speed"].as<float>(),
-	         doc["reload_speed"].as<float>(),
-	         doc["mag_size"].as<unsigned int>(),
-	         doc["mag_quantity"].as<unsigned int>(),
-	         {have_spread,
-	          {
-	              spread_min,  //
-	              spread_max,
-	          }},
-	         projectiles_per_shot,
-	         sounds,
-	         reload_sound}};
+	             spread_min,  //
+	             spread_max,
+	         }},
+	        projectiles_per_shot,
+	        sounds,
+	        reload_sound};
 }
 
 firearm_properties::fire_mode_t fire_mode_from_string(const std::string & name) {
@@ -0,0 +1,62 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "game_clock.hpp"
+
+
+const constexpr float game_clock::min_time_scale;
+
+
+game_clock::time_point game_clock::now() const noexcept {
+	return current;
+}
+
+game_clock::duration game_clock::tick_length() const noexcept {
+	return length;
+}
+
+unsigned int game_clock::ticks_per_second() const noexcept {
+	return rate;
+}
+
+void game_clock::advance() noexcept {
+	current += length;
+}
+
+float game_clock::time_scale() const noexcept {
+	return scale.load(std::memory_order_relaxed);
+}
+
+void game_clock::time_scale(float new_scale) noexcept {
+	scale.store(new_scale >= min_time_scale ? new_scale : min_time_scale, std::memory_order_relaxed);
+}
+
+bool game_clock::paused() const noexcept {
+	return stopped.load(std::memory_order_relaxed);
+}
+
+void game_clock::paused(bool pause) noexcept {
+	stopped.store(pause, std::memory_order_relaxed);
+}
+
+game_clock::game_clock(unsigned int ticks_per_second)
+      : current(), rate(ticks_per_second), length(std::chrono::duration_cast<duration>(std::chrono::seconds(1)) / ticks_per_second), scale(1), stopped(false) {}
@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <chrono>
+
+
+/// Simulated time, advanced by the world once per tick by a fixed nominal amount.
+///
+/// The time scale and pause flag don't affect the tick length, only how often the simulation thread ticks, and may be set from any thread.
+class game_clock {
+public:
+	using duration   = std::chrono::steady_clock::duration;
+	using time_point = std::chrono::time_point<game_clock, duration>;
+
+	/// Anything slower, including non-positive scales, is clamped up to this, since the tick length is divided by the scale
+	static const constexpr float min_time_scale = 1.f / 1024.f;
+
+private:
+	time_point current;
+	unsigned int rate;
+	duration length;
+	std::atomic<float> scale;
+	std::atomic<bool> stopped;
+
+public:
+	time_point now() const noexcept;
+	duration tick_length() const noexcept;
+	unsigned int ticks_per_second() const noexcept;
+	void advance() noexcept;
+
+	float time_scale() const noexcept;
+	void time_scale(float new_scale) noexcept;
+
+	bool paused() const noexcept;
+	void paused(bool pause) noexcept;
+
+	explicit game_clock(unsigned int ticks_per_second);
+};
@@ -0,0 +1,226 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "input_recording.hpp"
+#include "../reference/container.hpp"
+#include "../util/timing_stats.hpp"
+#include "../util/zstd.hpp"
+#include "entity/player.hpp"
+#include "firearm/firearm.hpp"
+#include "world.hpp"
+#include "world_snapshot.hpp"
+#include <chrono>
+#include <iostream>
+#include <jsonpp/parser.hpp>
+#include <type_traits>
+
+
+// The last byte is the format version: 2 made mouse positions window-relative
+static const constexpr char recording_magic[8] = {'B', 'A', 'R', 'R', 'E', 'C', '\0', '\2'};
+
+static const constexpr std::uint8_t input_left     = 1 << 0;
+static const constexpr std::uint8_t input_right    = 1 << 1;
+static const constexpr std::uint8_t input_up       = 1 << 2;
+static const constexpr std::uint8_t input_down     = 1 << 3;
+static const constexpr std::uint8_t input_joystick = 1 << 4;
+
+
+template <class T>
+static void write_raw(std::string & into, const T & what) {
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written raw");
+	into.append(reinterpret_cast<const char *>(&what), sizeof what);
+}
+
+template <class T>
+static bool read_raw(const std::string & from, std::size_t & position, T & what) {
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read raw");
+	if(from.size() - position < sizeof what)
+		return false;
+
+	std::copy(from.begin() + position, from.begin() + position + sizeof what, reinterpret_cast<char *>(&what));
+	position += sizeof what;
+	return true;
+}
+
+
+void input_recorder::record_tick(const tick_input & input, const std::vector<sf::Event> & events) {
+	const std::uint8_t flags = (input.left ? input_left : 0) | (input.right ? input_right : 0) | (input.up ? input_up : 0) | (input.down ? input_down : 0) |
+	                           (input.joystick_connected ? input_joystick : 0);
+	write_raw(data, flags);
+	write_raw(data, static_cast<std::int32_t>(input.mouse.x));
+	write_raw(data, static_cast<std::int32_t>(input.mouse.y));
+	if(input.joystick_connected) {
+		write_raw(data, input.left_stick);
+		write_raw(data, input.right_stick);
+	}
+
+	write_raw(data, static_cast<std::uint16_t>(events.size()));
+	for(auto && event : events)
+		write_raw(data, event);
+}
+
+void input_recorder::save(const std::string & path) {
+	background_jobs.submit(job_priority::compression, [path, data = std::move(data) ] {
+		if(const auto err = compress_string_to_file(path, data))
+			std::cerr << "Failed to save recording to " << path << ": " << err << '\n';
+	});
+	data.clear();
+}
+
+input_recorder::input_recorder(const game_world & world, sf::Vector2u world_size, const std::string & initial_save) {
+	data.append(recording_magic, sizeof recording_magic);
+	write_raw(data, world.master_seed());
+	write_raw(data, static_cast<std::uint32_t>(world_size.x));
+	write_raw(data, static_cast<std::uint32_t>(world_size.y));
+	write_raw(data, static_cast<std::uint32_t>(world.clock().ticks_per_second()));
+	write_raw(data, static_cast<std::uint64_t>(initial_save.size()));
+	data += initial_save;
+}
+
+
+const char * input_replay::error() const noexcept {
+	return err;
+}
+
+std::uint32_t input_replay::master_seed() const noexcept {
+	return seed;
+}
+
+sf::Vector2u input_replay::world_size() const noexcept {
+	return size;
+}
+
+unsigned int input_replay::tick_rate() const noexcept {
+	return rate;
+}
+
+std::size_t input_replay::populate(game_world & world) const {
+	if(initial_save.empty())
+		return world.spawn<player>(size);
+
+	json::value save;
+	json::parse(initial_save, save);
+
+	std::size_t player_id;
+	world.load(save.as<json::object>(), player_id);
+	return player_id;
+}
+
+bool input_replay::next_tick(tick_input & input, std::vector<sf::Event> & events) {
+	events.clear();
+	if(err || position == data.size())
+		return false;
+
+	std::uint8_t flags;
+	std::int32_t mouse_x, mouse_y;
+	std::uint16_t event_count;
+	if(!read_raw(data, position, flags) || !read_raw(data, position, mouse_x) || !read_raw(data, position, mouse_y))
+		return false;
+
+	input                    = {};
+	input.left               = flags & input_left;
+	input.right              = flags & input_right;
+	input.up                 = flags & input_up;
+	input.down               = flags & input_down;
+	input.joystick_connected = flags & input_joystick;
+	input.mouse              = {mouse_x, mouse_y};
+	if(input.joystick_connected && (!read_raw(data, position, input.left_stick) || !read_raw(data, position, input.right_stick)))
+		return false;
+
+	if(!read_raw(data, position, event_count))
+		return false;
+	events.resize(event_count);
+	for(auto && event : events)
+		if(!read_raw(data, position, event))
+			return false;
+
+	return true;
+}
+
+input_replay::input_replay(const std::string & path) : position(0), err(nullptr), seed(0), rate(0) {
+	bool opened;
+	std::tie(data, opened, err) = decompress_file_to_string(path);
+	if(!opened)
+		err = "couldn't open file";
+	if(err)
+		return;
+
+	char magic[sizeof recording_magic];
+	std::uint32_t size_x, size_y, tick_rate;
+	std::uint64_t save_size;
+	if(!read_raw(data, position, magic) || !std::equal(std::begin(magic), std::end(magic) - 1, std::begin(recording_magic))) {
+		err = "not a recording";
+		return;
+	}
+	if(magic[sizeof magic - 1] != recording_magic[sizeof recording_magic - 1]) {
+		err = "recorded in an unsupported format version";
+		return;
+	}
+	if(!read_raw(data, position, seed) || !read_raw(data, position, size_x) || !read_raw(data, position, size_y) || !read_raw(data, position, tick_rate) ||
+	   !read_raw(data, position, save_size) || data.size() - position < save_size) {
+		err = "truncated header";
+		return;
+	}
+
+	size = {size_x, size_y};
+	rate = tick_rate;
+	initial_save.assign(data, position, save_size);
+	position += save_size;
+}
+
+
+int run_headless_replay(const std::string & path) {
+	input_replay replay(path);
+	if(const auto err = replay.error()) {
+		std::cerr << "Failed to read recording " << path << ": " << err << '\n';
+		return 1;
+	}
+
+	game_world world(replay.master_seed(), replay.tick_rate());
+	world.saves_enabled(false);
+	sound_voices.mute();
+
+	const auto load_start = std::chrono::steady_clock::now();
+	const auto firearms   = firearm::properties().size();
+	const auto load_time  = std::chrono::steady_clock::now() - load_start;
+	replay.populate(world);
+
+	timing_stats tick_times;
+	world_snapshot snapshot;
+	tick_input input;
+	std::vector<sf::Event> events;
+	std::size_t ticks = 0;
+	const auto start  = std::chrono::steady_clock::now();
+	for(; replay.next_tick(input, events); ++ticks) {
+		const auto tick_start = std::chrono::steady_clock::now();
+		world.tick(replay.world_size(), input, events);
+		world.snapshot(snapshot);
+		tick_times.record(std::chrono::steady_clock::now() - tick_start);
+	}
+	const auto total = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Loaded " << firearms << " firearms in " << std::chrono::duration<double, std::milli>(load_time).count() << " ms\n"
+	          << tick_times.summary("Simulation tick") << '\n'
+	          << audio_assets.summary() << '\n'
+	          << "Replayed " << ticks << " ticks in " << std::chrono::duration<double, std::milli>(total).count() << " ms\n";
+	return 0;
+}
@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "tick_input.hpp"
+#include <SFML/System.hpp>
+#include <SFML/Window.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+class game_world;
+
+
+/// Accumulates a session's per-tick input, which, together with the world's master seed, is enough to reproduce it exactly.
+///
+/// See doc/recording.md for the format.
+class input_recorder {
+private:
+	std::string data;
+
+public:
+	void record_tick(const tick_input & input, const std::vector<sf::Event> & events);
+
+	/// Compresses the recording into `path` on the background job system
+	void save(const std::string & path);
+
+	/// Start recording a session in `world`, at its seed and tick rate
+	input_recorder(const game_world & world, sf::Vector2u world_size, const std::string & initial_save);
+};
+
+class input_replay {
+private:
+	std::string data;
+	std::size_t position;
+	const char * err;
+
+	std::uint32_t seed;
+	sf::Vector2u size;
+	unsigned int rate;
+	std::string initial_save;
+
+public:
+	/// nullptr if the recording was read successfully
+	const char * error() const noexcept;
+
+	std::uint32_t master_seed() const noexcept;
+	sf::Vector2u world_size() const noexcept;
+	unsigned int tick_rate() const noexcept;
+
+	/// Set the world up as it was when the recording began, returning the player's ID
+	std::size_t populate(game_world & world) const;
+
+	/// Read the next tick into the arguments, returning false when the recording's over
+	bool next_tick(tick_input & input, std::vector<sf::Event> & events);
+
+	explicit input_replay(const std::string & path);
+};
+
+
+/// Run the replay as fast as possible without a window or sound, printing how long loading the firearms and each tick took
+int run_headless_replay(const std::string & path);
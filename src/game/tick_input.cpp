@@ -0,0 +1,44 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "tick_input.hpp"
+#include "../reference/joystick_info.hpp"
+
+
+tick_input tick_input::sample(const sf::Window & window) {
+	tick_input input{};
+	input.left               = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A);
+	input.right              = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D);
+	input.up                 = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W);
+	input.down               = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S);
+	input.mouse              = sf::Mouse::getPosition(window);
+	input.joystick_connected = sf::Joystick::isConnected(0);
+
+	if(input.joystick_connected) {
+		input.left_stick  = {sf::Joystick::getAxisPosition(0, X360_axis_mappings::LeftStickHorizontal),
+		                    sf::Joystick::getAxisPosition(0, X360_axis_mappings::LeftStickVertical)};
+		input.right_stick = {sf::Joystick::getAxisPosition(0, X360_axis_mappings::RightStickHorizontal),
+		                     sf::Joystick::getAxisPosition(0, X360_axis_mappings::RightStickVertical)};
+	}
+
+	return input;
+}
@@ -41,16 +41,15 @@ static const constexpr auto max_random_tries = 10u;
 
 
 size_t game_world::reserve_eid() {
-	static auto rand    = seed11::make_seeded<std::mt19937>();
-	static auto id_dist = std::uniform_int_distribution<size_t>(0, pow(10, max_id_len));
+	auto id_dist = std::uniform_int_distribution<size_t>(0, pow(10, max_id_len));
 
 	for(auto i = 0u; i < max_random_tries; ++i) {
-		const auto generated = id_dist(rand);
+		const auto generated = id_dist(rng);
 		if(entities.find(generated) == entities.end())
 			return generated;
 	}
 
-	return std::uniform_int_distribution<size_t>{}(rand);
+	return std::uniform_int_distribution<size_t>{}(rng);
 }
 
 size_t game_world::spawn_p(size_t id, std::unique_ptr<entity> ent) {
@@ -66,7 +65,37 @@ const entity & game_world::ent(size_t id) const {
 	return *entities.at(id);
 }
 
-void game_world::tick(sf::Vector2u screen_size) {
+std::mt19937 & game_world::random() noexcept {
+	return rng;
+}
+
+std::uint32_t game_world::master_seed() const noexcept {
+	return seed;
+}
+
+const tick_input & game_world::input() const noexcept {
+	return current_input;
+}
+
+game_clock & game_world::clock() noexcept {
+	return sim_clock;
+}
+
+const game_clock & game_world::clock() const noexcept {
+	return sim_clock;
+}
+
+void game_world::saves_enabled(bool enabled) noexcept {
+	saving = enabled;
+}
+
+void game_world::tick(sf::Vector2u screen_size, const tick_input & input, const std::vector<sf::Event> & events) {
+	current_input = input;
+	for(auto && event : events)
+		handle_event(event);
+
+	sim_clock.advance();
+
 	ticking = true;
 	for(auto && entity : entities)
 		entity.second->tick(screen_size.x, screen_size.y);
@@ -78,21 +107,27 @@ void game_world::tick(sf::Vector2u screen_size) {
 }
 
 void game_world::handle_event(const sf::Event & event) {
-	if(event.type == sf::Event::EventType::KeyPressed && event.key.control && event.key.code == sf::Keyboard::Key::LBracket) {
+	if(saving && event.type == sf::Event::EventType::KeyPressed && event.key.control && event.key.code == sf::Keyboard::Key::LBracket) {
 		json::object ents;
 		for(auto && pr : entities)
 			ents.emplace(std::to_string(pr.first), pr.second->write_to_json());
 
-		save_threads.emplace_back(
-		    [&](auto && out) {
-			    const auto fname = fs_safe_current_datetime();
-			    if(const auto err_s = compress_string_to_file(saves_root + '/' + fname + ".sav", out))
-				    save_error_text = {{fmt::format(global_iser.translate_key("gui.world.text.save_compression_error"), err_s), font_monospace, 10},
-				                       application::effective_FPS() * 10};
-			    else
-				    save_text = {{fmt::format(global_iser.translate_key("gui.world.text.save_success"), fname), font_monospace, 10}, application::effective_FPS() * 2};
-			  },
-		    json::dump_string(ents, {0, json::format_options::minify, 20}));
+		save_worker.submit([&, guard = std::weak_ptr<void>(continuation_guard), out = json::dump_string(ents, {0, json::format_options::minify, 20}) ] {
+			const auto fname = fs_safe_current_datetime();
+			const auto err_s = compress_string_to_file(saves_root + '/' + fname + ".sav", out);
+
+			application::post_to_main_thread(guard, [this, fname, err_s] {
+				if(err_s) {
+					save_error_text = {{fmt::format(global_iser.translate_key("gui.world.text.save_compression_error"), err_s), font_monospace, 10},
+					                   tween<std::chrono::steady_clock>(10s)};
+					save_error_text.second.start(std::chrono::steady_clock::now());
+				} else {
+					save_text = {{fmt::format(global_iser.translate_key("gui.world.text.save_success"), fname), font_monospace, 10},
+					             tween<std::chrono::steady_clock>(2s)};
+					save_text.second.start(std::chrono::steady_clock::now());
+				}
+			});
+		});
 	}
 
 	for(const auto & entity : entities)
@@ -100,36 +135,27 @@ void game_world::handle_event(const sf::Event & event) {
 			handler->handle_event(event);
 }
 
-void game_world::draw(sf::RenderTarget & upon) {
-	for(const auto & entity : entities)
-		if(const auto drwbl = dynamic_cast<const sf::Drawable *>(entity.second.get()))
-			upon.draw(*drwbl);
-
-	if(save_text.second) {
-		const auto size        = save_text.first.getLocalBounds();
-		const auto eff_ps      = application::effective_FPS();
-		const auto full_length = eff_ps * 2;
-		const auto slide_len   = eff_ps / 2;
-
-		auto y = 0.;
-		auto x = 1.;
-		if(full_length - save_text.second < slide_len) {
-			const auto slide_progress = (full_length - save_text.second) / static_cast<double>(slide_len);
-			y = -((slide_progress - 1.) * (slide_progress - 1.));
-		} else if(save_text.second < slide_len) {
-			const auto slide_progress = save_text.second / static_cast<double>(slide_len);
-			x = slide_progress * slide_progress;
-		}
+void game_world::snapshot(world_snapshot & into) const {
+	into.clear();
+	for(auto && entity : entities)
+		entity.second->snapshot(into);
+}
+
+void game_world::draw_overlay(sf::RenderTarget & upon) {
+	const auto now = std::chrono::steady_clock::now();
+
+	// Slides down from above the top edge over the first quarter, then out past the right edge over the last one
+	if(save_text.second.running(now)) {
+		const auto size = save_text.first.getLocalBounds();
+		const auto y    = easing::quadratic_out(save_text.second.progress(now, 0, .25f)) - 1.f;
+		const auto x    = easing::quadratic_in(1.f - save_text.second.progress(now, .75f, 1));
 		save_text.first.setPosition(upon.getSize().x - x * (size.width + static_cast<std::size_t>(save_text.first.getCharacterSize() * .75)), y * size.height);
 
 		upon.draw(save_text.first);
-		--save_text.second;
 	}
 
-	if(save_error_text.second) {
+	if(save_error_text.second.running(now))
 		upon.draw(save_error_text.first);
-		--save_error_text.second;
-	}
 }
 
 void game_world::despawn(size_t id) {
@@ -140,7 +166,7 @@ void game_world::despawn(size_t id) {
 }
 
 
-game_world::game_world(const json::object & save, std::size_t & pid) {
+void game_world::load(const json::object & save, std::size_t & pid) {
 	for(auto && kv : save) {
 		const auto id = std::strtoull(kv.first.c_str(), nullptr, 10);
 		auto ent      = entity::from_json(*this, kv.second.as<json::object>());
@@ -151,8 +177,10 @@ game_world::game_world(const json::object & save, std::size_t & pid) {
 	}
 }
 
-game_world::~game_world() {
-	for(auto && thr : save_threads)
-		if(thr.joinable())
-			thr.join();
+game_world::game_world(unsigned int tick_rate) : game_world(seed11::make_seeded<std::mt19937>()(), tick_rate) {}
+
+game_world::game_world(std::uint32_t seed_a, unsigned int tick_rate) : seed(seed_a), rng(seed), sim_clock(tick_rate) {}
+
+game_world::game_world(const json::object & save, std::size_t & pid, unsigned int tick_rate) : game_world(tick_rate) {
+	load(save, pid);
 }
@@ -23,13 +23,21 @@
 #pragma once
 
 
+#include "../reference/container.hpp"
+#include "../util/coalescing_worker.hpp"
+#include "../util/tween.hpp"
 #include "entity/entity.hpp"
+#include "game_clock.hpp"
+#include "tick_input.hpp"
+#include "world_snapshot.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
+#include <chrono>
 #include <functional>
 #include <jsonpp/value.hpp>
 #include <map>
-#include <thread>
+#include <memory>
+#include <random>
 #include <vector>
 
 
@@ -38,20 +46,40 @@ private:
 	std::map<std::size_t, std::unique_ptr<entity>> entities;
 	std::vector<std::size_t> sheduled_for_deletion;
 	bool ticking = false;
-	std::pair<sf::Text, unsigned int> save_text;
-	std::pair<sf::Text, unsigned int> save_error_text;
-	std::vector<std::thread> save_threads;
+	bool saving  = true;
+	std::uint32_t seed;
+	std::mt19937 rng;
+	game_clock sim_clock;
+	tick_input current_input{};
+	std::pair<sf::Text, tween<std::chrono::steady_clock>> save_text;
+	std::pair<sf::Text, tween<std::chrono::steady_clock>> save_error_text;
+	std::shared_ptr<void> continuation_guard = std::make_shared<char>();
+	coalescing_worker save_worker{background_jobs, job_priority::compression};
 
 	std::size_t reserve_eid();
 	std::size_t spawn_p(std::size_t id, std::unique_ptr<entity> ep);
+	void handle_event(const sf::Event & event);
 
 public:
 	entity & ent(std::size_t id);
 	const entity & ent(std::size_t id) const;
 
-	void tick(sf::Vector2u screen_size);
-	void handle_event(const sf::Event & event);
-	void draw(sf::RenderTarget & upon);
+	/// All randomness affecting the simulation must come from here, so that a recorded session replays identically
+	std::mt19937 & random() noexcept;
+	std::uint32_t master_seed() const noexcept;
+	const tick_input & input() const noexcept;
+	game_clock & clock() noexcept;
+	const game_clock & clock() const noexcept;
+	/// Whether the save key writes a savefile, on by default
+	void saves_enabled(bool enabled) noexcept;
+
+	// These run on the simulation thread
+	/// Handle the tick's events, then advance every entity, both seeing the tick's input
+	void tick(sf::Vector2u screen_size, const tick_input & input, const std::vector<sf::Event> & events);
+	void snapshot(world_snapshot & into) const;
+
+	// This runs on the main thread
+	void draw_overlay(sf::RenderTarget & upon);
 
 	template <class ET, class... AT>
 	std::size_t spawn(AT &&... at) {
@@ -67,7 +95,9 @@ public:
 
 	void despawn(std::size_t id);
 
-	game_world() = default;
-	game_world(const json::object & save, std::size_t & pid);
-	~game_world();
+	void load(const json::object & save, std::size_t & pid);
+
+	explicit game_world(unsigned int tick_rate);
+	game_world(std::uint32_t seed, unsigned int tick_rate);
+	game_world(const json::object & save, std::size_t & pid, unsigned int tick_rate);
 };
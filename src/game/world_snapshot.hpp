@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <SFML/System.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+struct bullet_snapshot {
+	float x, y;
+	float motion_x, motion_y;
+};
+
+struct player_snapshot {
+	float x, y;
+	float rotation;
+	float gun_progress;
+	bool gun_name_shown;
+	sf::Uint8 gun_name_alpha;
+	std::string gun_name;
+};
+
+/// Everything needed to draw a game_world, published by the simulation thread once per tick
+struct world_snapshot {
+	std::vector<bullet_snapshot> bullets;
+	std::vector<player_snapshot> players;
+
+	float player_health        = 0;
+	float player_gun_depletion = 0;
+	/// When the earliest input event handled this tick was polled, or the epoch if none were
+	std::chrono::steady_clock::time_point input_polled;
+
+	void clear();
+};
@@ -21,21 +21,24 @@
 
 
 #include "app/application.hpp"
+#include "game/input_recording.hpp"
 #include "reference/container.hpp"
 #include <audiere.h>
 #include <cimpoler-meta.hpp>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 #include <zstd/zstd.h>
 
 
 static void credit();
 static std::pair<std::string, int> check_config();
-static void init_app(application & app, int argc, char * argv[]);
+static std::string init_app(application & app, int argc, char * argv[]);
 static void init_deps(application & app);
 
 
 int main(int argc, char * argv[]) {
+	start_loading_assets();
 	credit();
 	{
 		const auto cfg_result = check_config();
@@ -47,7 +50,10 @@ int main(int argc, char * argv[]) {
 
 	application app;
 	init_deps(app);
-	init_app(app, argc, argv);
+	const auto headless_replay = init_app(app, argc, argv);
+	if(!headless_replay.empty())
+		return run_headless_replay(headless_replay);
+
 	const auto result = app.run();
 	if(result)
 		std::cerr << "`app.run()` failed with " << result << "! Oh noes!";
@@ -83,5 +89,38 @@ static std::pair<std::string, int> check_config() {
 	return {"", 0};
 }
 
-static void init_app(application &, int, char * []) {}
+// --record           record every game session into recordings/
+// --replay FILE      play back a recording instead of starting normally
+// --headless         with --replay, simulate it without a window as fast as possible
+// --profile-startup  print how long each startup phase took once the first frame is up
+// --print-stats      print frame, tick, input and audio statistics as each game and the application are closed
+// --exit-after-first-frame
+//                    quit as soon as the first frame is up, for startup benchmarks
+static std::string init_app(application & app, int argc, char * argv[]) {
+	std::string replay;
+	auto headless = false;
+	for(auto i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if(arg == "--record")
+			app.record_sessions();
+		else if(arg == "--replay" && i + 1 < argc)
+			replay = argv[++i];
+		else if(arg == "--headless")
+			headless = true;
+		else if(arg == "--profile-startup")
+			app.profile_startup();
+		else if(arg == "--print-stats")
+			app.print_statistics();
+		else if(arg == "--exit-after-first-frame")
+			app.exit_on_first_frame();
+		else
+			std::cerr << "Unknown argument " << arg << " ignored\n";
+	}
+
+	if(headless)
+		return replay;
+	if(!replay.empty())
+		app.start_with_replay(std::move(replay));
+	return {};
+}
 static void init_deps(application &) {}
@@ -35,11 +35,14 @@ namespace config_subcategories {
 		std::string & language;
 		float & controller_deadzone;
 		bool & use_network;
+		unsigned int & job_threads;
+		bool & hot_reload_assets;
 
 		template <class Archive>
 		void serialize(Archive & archive) {
 			archive(cereal::make_nvp("controller_deadzone", controller_deadzone), cereal::make_nvp("language", language),
-			        cereal::make_nvp("use_network", use_network), cereal::make_nvp("available_languages", config::available_languages()));
+			        cereal::make_nvp("use_network", use_network), cereal::make_nvp("job_threads", job_threads),
+			        cereal::make_nvp("hot_reload_assets", hot_reload_assets), cereal::make_nvp("available_languages", config::available_languages()));
 		}
 	};
 
@@ -48,11 +51,23 @@ namespace config_subcategories {
 		unsigned int & FPS;
 		bool & play_sounds;
 		unsigned int & splash_length;
+		bool & dynamic_resolution;
+		float & dynamic_resolution_min_scale;
+		float & dynamic_resolution_max_scale;
+		unsigned int & background_FPS;
+		float & background_time_scale;
+		float & background_volume;
+		bool & low_latency;
+		bool & low_latency_gl_finish;
 
 		template <class Archive>
 		void serialize(Archive & archive) {
 			archive(cereal::make_nvp("FPS", FPS), cereal::make_nvp("vsync", vsync), cereal::make_nvp("play_sounds", play_sounds),
-			        cereal::make_nvp("splash_length", splash_length));
+			        cereal::make_nvp("splash_length", splash_length), cereal::make_nvp("dynamic_resolution", dynamic_resolution),
+			        cereal::make_nvp("dynamic_resolution_min_scale", dynamic_resolution_min_scale),
+			        cereal::make_nvp("dynamic_resolution_max_scale", dynamic_resolution_max_scale), cereal::make_nvp("background_FPS", background_FPS),
+			        cereal::make_nvp("background_time_scale", background_time_scale), cereal::make_nvp("background_volume", background_volume),
+			        cereal::make_nvp("low_latency", low_latency), cereal::make_nvp("low_latency_gl_finish", low_latency_gl_finish));
 		}
 	};
 
@@ -72,21 +87,27 @@ namespace config_subcategories {
 	struct sound {
 		float & music_volume;
 		float & sound_effect_volume;
+		unsigned int & max_voices;
+		unsigned int & max_voices_per_sound;
 
 		template <class Archive>
 		void serialize(Archive & archive) {
-			archive(cereal::make_nvp("music_volume", music_volume), cereal::make_nvp("sound_effect_volume", sound_effect_volume));
+			archive(cereal::make_nvp("music_volume", music_volume), cereal::make_nvp("sound_effect_volume", sound_effect_volume),
+			        cereal::make_nvp("max_voices", max_voices), cereal::make_nvp("max_voices_per_sound", max_voices_per_sound));
 		}
 	};
 }
 
 template <class Archive>
 void serialize(Archive & archive, config & cc) {
-	archive(cereal::make_nvp("system", config_subcategories::system{cc.language, cc.controller_deadzone, cc.use_network}),
-	        cereal::make_nvp("application", config_subcategories::application{cc.vsync, cc.FPS, cc.play_sounds, cc.splash_length}),
+	archive(cereal::make_nvp("system", config_subcategories::system{cc.language, cc.controller_deadzone, cc.use_network, cc.job_threads, cc.hot_reload_assets}),
+	        cereal::make_nvp("application", config_subcategories::application{cc.vsync, cc.FPS, cc.play_sounds, cc.splash_length, cc.dynamic_resolution,
+	                                                                          cc.dynamic_resolution_min_scale, cc.dynamic_resolution_max_scale, cc.background_FPS,
+	                                                                          cc.background_time_scale, cc.background_volume, cc.low_latency,
+	                                                                          cc.low_latency_gl_finish}),
 	        cereal::make_nvp(
 	            "player", config_subcategories::player{cc.player_speed, cc.player_seconds_to_full_speed, cc.player_default_firearm, cc.player_gun_popup_length}),
-	        cereal::make_nvp("sound", config_subcategories::sound{cc.music_volume, cc.sound_effect_volume}));
+	        cereal::make_nvp("sound", config_subcategories::sound{cc.music_volume, cc.sound_effect_volume, cc.max_voices, cc.max_voices_per_sound}));
 }
 
 
@@ -32,19 +32,31 @@ public:
 	std::string language      = "en_US";
 	float controller_deadzone = 10;
 	bool use_network          = true;
-
-	bool vsync                 = true;
-	unsigned int FPS           = 60;
-	bool play_sounds           = true;
-	unsigned int splash_length = 2;
+	unsigned int job_threads  = 0;
+	bool hot_reload_assets    = false;
+
+	bool vsync                         = true;
+	unsigned int FPS                   = 60;
+	bool play_sounds                   = true;
+	unsigned int splash_length         = 2;
+	bool dynamic_resolution            = false;
+	float dynamic_resolution_min_scale = .5f;
+	float dynamic_resolution_max_scale = 1.f;
+	unsigned int background_FPS        = 10;
+	float background_time_scale        = 0.f;
+	float background_volume            = .3f;
+	bool low_latency                   = false;  // Ticks run up to half a tick early or late to take each frame's input, on the same schedule
+	bool low_latency_gl_finish         = true;
 
 	float player_speed                   = 1;
 	float player_seconds_to_full_speed   = .4f;
 	std::string player_default_firearm   = "default";
 	unsigned int player_gun_popup_length = 3;
 
-	float music_volume        = .8f;
-	float sound_effect_volume = 1.f;
+	float music_volume                = .8f;
+	float sound_effect_volume         = 1.f;
+	unsigned int max_voices           = 32;
+	unsigned int max_voices_per_sound = 4;
 
 
 	static std::vector<std::string> available_languages();
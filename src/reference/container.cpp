@@ -22,9 +22,12 @@
 
 #include "container.hpp"
 #include "../util/file.hpp"
+#include "../util/startup_profile.hpp"
 #include <whereami++.hpp>
 
 
+const std::chrono::steady_clock::time_point process_start(startup_origin());
+
 const std::string assets_root(whereami::executable_dir() + "/assets");
 const std::string textures_root(assets_root + "/textures");
 const std::string font_root(assets_root + "/fonts");
@@ -42,30 +45,79 @@ const std::string saves_root([] {
 	create_directory(dir);
 	return dir;
 }());
+const std::string recordings_root([] {
+	const auto dir = whereami::executable_dir() + "/recordings";
+	create_directory(dir);
+	return dir;
+}());
+const std::string cache_root([] {
+	const auto dir = whereami::executable_dir() + "/cache";
+	create_directory(dir);
+	return dir;
+}());
+static const auto directories_created = startup_phase("directories");
+/***/ asset_archive packed_assets(whereami::executable_dir() + "/assets.pak", assets_root);
+static const auto archive_mapped = startup_phase("asset archive");
 
 const std::string app_name("BarbersAndRebarbs");
 /***/ config app_configuration(whereami::executable_dir() + "/" + app_name + ".cfg");
+static const auto config_loaded = startup_phase("config");
 
-const cpp_localiser::localiser fallback_iser(localization_root);
+/***/ cpp_localiser::localiser fallback_iser(localization_root);
 /***/ cpp_localiser::localiser local_iser(localization_root, app_configuration.language);
 /***/ cpp_localiser::localiser global_iser(local_iser, fallback_iser);
+static const auto localisers_loaded = startup_phase("localisers");
 
 
-const sf::Font font_pixelish([] {
+const async_asset<sf::Font> font_pixelish(startup_timed("font_pixelish", [] {
 	sf::Font tmp;
-	tmp.loadFromFile(font_root + "/04B_30.ttf");
+	packed_assets.load_into(tmp, font_root + "/04B_30.ttf");
 	return tmp;
-}());
-const sf::Font font_swirly([] {
+}));
+const async_asset<sf::Font> font_swirly(startup_timed("font_swirly", [] {
 	sf::Font tmp;
-	tmp.loadFromFile(font_root + "/MACABRA_.ttf");
+	packed_assets.load_into(tmp, font_root + "/MACABRA_.ttf");
 	return tmp;
-}());
-const sf::Font font_monospace([] {
+}));
+const async_asset<sf::Font> font_monospace(startup_timed("font_monospace", [] {
 	sf::Font tmp;
-	tmp.loadFromFile(font_root + "/DejaVuSansMono.ttf");
+	packed_assets.load_into(tmp, font_root + "/DejaVuSansMono.ttf");
 	return tmp;
-}());
+}));
+
+const async_asset<sf::Image> cursor_image(startup_timed("cursor_image", [] {
+	sf::Image tmp;
+	packed_assets.load_into(tmp, textures_root + "/gui/general/cursor.png");
+	return tmp;
+}));
+const async_asset<sf::Image> window_icon_image(startup_timed("window_icon_image", [] {
+	sf::Image tmp;
+	packed_assets.load_into(tmp, textures_root + "/gui/general/window_main.png");
+	return tmp;
+}));
+const async_asset<sf::Image> splash_image(startup_timed("splash_image", [] {
+	sf::Image tmp;
+	packed_assets.load_into(tmp, textures_root + "/gui/main/splash.png");
+	return tmp;
+}));
+
+
+const async_asset<audiere::AudioDevicePtr> audio_device(startup_timed("audio_device", [] { return audiere::AudioDevicePtr(audiere::OpenDevice()); }));
+audio_cache audio_assets;
+voice_pool sound_voices;
+
+
+job_system background_jobs(app_configuration.job_threads);
+static const auto job_system_started = startup_phase("job system");
+
 
+void start_loading_assets() {
+	// Whatever the splash screen needs goes ahead of everything else
+	for(auto && asset : {&cursor_image, &window_icon_image, &splash_image})
+		asset->start(background_jobs, job_priority::assets);
+	font_pixelish.start(background_jobs, job_priority::assets);
 
-const audiere::AudioDevicePtr audio_device(audiere::OpenDevice());
+	font_swirly.start(background_jobs, job_priority::io);
+	font_monospace.start(background_jobs, job_priority::io);
+	audio_device.start(background_jobs, job_priority::io);
+}
@@ -23,13 +23,21 @@
 #pragma once
 
 
+#include "../sound/audio_cache.hpp"
+#include "../sound/voice_pool.hpp"
+#include "../util/asset_archive.hpp"
+#include "../util/async_asset.hpp"
+#include "../util/job_system.hpp"
 #include "config.hpp"
 #include "cpp-localiser.hpp"
 #include <SFML/Graphics.hpp>
 #include <audiere.h>
+#include <chrono>
 #include <string>
 
 
+extern const std::chrono::steady_clock::time_point process_start;
+
 extern const std::string assets_root;
 extern const std::string textures_root;
 extern const std::string font_root;
@@ -37,20 +45,36 @@ extern const std::string sound_root;
 extern const std::string localization_root;
 extern const std::string drawing_root;
 extern const std::string firearm_root;
+extern /***/ asset_archive packed_assets;
 extern const std::string screenshots_root;
 extern const std::string saves_root;
+extern const std::string recordings_root;
+extern const std::string cache_root;
 
 extern const std::string app_name;
 extern /***/ config app_configuration;
 
-extern const cpp_localiser::localiser fallback_iser;
+extern /***/ cpp_localiser::localiser fallback_iser;
 extern /***/ cpp_localiser::localiser local_iser;
 extern /***/ cpp_localiser::localiser global_iser;
 
 
-extern const sf::Font font_pixelish;
-extern const sf::Font font_swirly;
-extern const sf::Font font_monospace;
+extern const async_asset<sf::Font> font_pixelish;
+extern const async_asset<sf::Font> font_swirly;
+extern const async_asset<sf::Font> font_monospace;
+
+extern const async_asset<sf::Image> cursor_image;
+extern const async_asset<sf::Image> window_icon_image;
+extern const async_asset<sf::Image> splash_image;
+
+
+extern const async_asset<audiere::AudioDevicePtr> audio_device;
+extern audio_cache audio_assets;
+extern voice_pool sound_voices;
+
+
+extern job_system background_jobs;
 
 
-extern const audiere::AudioDevicePtr audio_device;
+/// Start loading the fonts, images and audio device on background_jobs, the ones the splash screen needs first; call as early as possible
+void start_loading_assets();
@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "hot_reload.hpp"
+#include "../app/application.hpp"
+#include "../game/firearm/firearm.hpp"
+#include "../render/drawing.hpp"
+#include "../util/file_watch.hpp"
+#include "container.hpp"
+#include <iostream>
+
+
+static std::string strip_json_extension(const std::string & fname) {
+	static const std::string extension = ".json";
+	if(fname.size() > extension.size() && fname.compare(fname.size() - extension.size(), extension.size(), extension) == 0)
+		return fname.substr(0, fname.size() - extension.size());
+	else
+		return {};
+}
+
+
+void start_asset_hot_reload() {
+	static file_watch watch;
+
+	// Edits are made to the loose files, so they have to win over the packed ones
+	packed_assets.loose_files_first();
+
+	watch.watch(firearm_root, [](const std::string & fname) {
+		background_jobs.submit(job_priority::io, [fname] {
+			try {
+				auto props = firearm::load_properties(firearm_root + '/' + fname);
+				application::post_to_main_thread([props = std::move(props) ] { firearm::replace_properties(props); });
+			} catch(const std::exception & exc) {
+				std::cerr << "Failed to reload gun " << fname << ": " << exc.what() << '\n';
+			}
+		});
+	});
+
+	watch.watch(drawing_root, [](const std::string & fname) {
+		const auto name = strip_json_extension(fname);
+		if(name.empty())
+			return;
+
+		background_jobs.submit(job_priority::io, [name] {
+			try {
+				auto mdl = drawing::load_model(name);
+				application::post_to_main_thread([name, mdl = std::move(mdl) ] { drawing::replace_model(name, mdl); });
+			} catch(const std::exception & exc) {
+				std::cerr << "Failed to reload drawing " << name << ": " << exc.what() << '\n';
+			}
+		});
+	});
+
+	// Localisers are only used on the main thread, which is also the one that changes the language, so they're rebuilt there
+	watch.watch(localization_root, [](const std::string &) {
+		application::post_to_main_thread([] {
+			fallback_iser = cpp_localiser::localiser(localization_root);
+			local_iser    = cpp_localiser::localiser(localization_root, app_configuration.language);
+			global_iser   = cpp_localiser::localiser(local_iser, fallback_iser);
+		});
+	});
+
+	watch.start();
+}
@@ -23,12 +23,10 @@
 #include "bezier_curve.hpp"
 #include "../util/vector.hpp"
 #include <algorithm>
-#include <functional>
+#include <cmath>
 
 
-float bezier_curve::bezier_step       = .0001f;
-bool bezier_curve::optimize_points    = true;
-float bezier_curve::optimize_prettily = .01f;
+float bezier_curve::tolerance = .25f;
 
 
 bezier_curve::bezier_curve(sf::Vector2f the_start_point, sf::Vector2f the_control_point, sf::Vector2f the_end_point)
@@ -41,24 +39,35 @@ void bezier_curve::swap(bezier_curve & with) {
 	std::swap(control_point, with.control_point);
 	std::swap(end_point, with.end_point);
 	vertices.swap(with.vertices);
+	std::swap(tessellated_scale, with.tessellated_scale);
 }
 
 void bezier_curve::draw(sf::RenderTarget & target, sf::RenderStates states) const {
+	const auto & strip = line_strip();
 	states.transform *= getTransform();
-	target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::LineStrip, states);
+	target.draw(strip.data(), strip.size(), sf::PrimitiveType::LineStrip, states);
 }
 
 void bezier_curve::compute_vertices() {
-	vertices.clear();
-	for(float t = 0; t <= 1; t += bezier_step)
-		vertices.emplace_back((1 - t) * (1 - t) * start_point + 2 * (1 - t) * t * control_point + t * t * end_point, sf::Color::White);
-
-	if(optimize_points) {
-		const unsigned int additional_offset = optimize_prettily * vertices.size();
-		vertices.erase(
-		    unique(vertices.begin() + additional_offset, vertices.end() - additional_offset,
-		           [&](auto && lhs, auto && rhs) { return (round(lhs.position.x) == round(rhs.position.x)) && (round(lhs.position.y) == round(rhs.position.y)); }),
-		    vertices.end() - additional_offset);
+	tessellate();
+}
+
+const std::vector<sf::Vertex> & bezier_curve::line_strip() const {
+	if(getScale() != tessellated_scale)
+		tessellate();
+	return vertices;
+}
+
+void bezier_curve::tessellate() const {
+	tessellated_scale = getScale();
+
+	const auto deviation = (start_point - 2.f * control_point + end_point) * tessellated_scale;
+	const auto steps     = std::max(static_cast<unsigned int>(std::ceil(std::sqrt(std::hypot(deviation.x, deviation.y) / (4 * tolerance)))), 1u);
+
+	vertices.resize(steps + 1);
+	for(auto i = 0u; i <= steps; ++i) {
+		const auto t = static_cast<float>(i) / steps;
+		vertices[i]  = sf::Vertex((1 - t) * (1 - t) * start_point + 2 * (1 - t) * t * control_point + t * t * end_point, sf::Color::White);
 	}
 	vertices.shrink_to_fit();
 }
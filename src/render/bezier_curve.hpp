@@ -38,16 +38,22 @@
 // p[0] -> start
 // p[1] -> control
 // p[2] -> end
+//
+// The second derivative, 2 * (p[0] - 2 * p[1] + p[2]), is constant along the whole curve,
+// so n equal steps of t stray at most |p[0] - 2 * p[1] + p[2]| / (4 * n * n) from it anywhere,
+// and the fewest steps within a tolerance can be computed outright instead of found by recursive subdivision.
 
 
 class bezier_curve : public sf::Drawable, public sf::Transformable {
 private:
-	std::vector<sf::Vertex> vertices;
+	mutable std::vector<sf::Vertex> vertices;
+	mutable sf::Vector2f tessellated_scale;
+
+	void tessellate() const;
 
 public:
-	static float bezier_step;
-	static bool optimize_points;
-	static float optimize_prettily;
+	/// How far, in pixels, the drawn line strip may stray from the real curve
+	static float tolerance;
 
 
 	sf::Vector2f start_point;
@@ -60,5 +66,7 @@ public:
 
 	virtual void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
 
-	void compute_vertices();  // Call after messing with `*_point`s
+	void compute_vertices();  // Call after messing with `*_point`s; scaling re-tessellates by itself
+	/// The line strip drawn at the current scale, untransformed
+	const std::vector<sf::Vertex> & line_strip() const;
 };
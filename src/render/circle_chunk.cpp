@@ -21,33 +21,66 @@
 
 
 #include "circle_chunk.hpp"
+#include <algorithm>
 #include <cmath>
-#include <vector>
+#include <map>
+#include <mutex>
+
+
+static const auto tau = std::acos(-1.f) * 2;
+
+
+/// `points` + 1 evenly spaced points around the unit circle, the last one back at the first, shared by every chunk with the same amount of points
+static const std::vector<sf::Vector2f> & unit_circle(unsigned int points) {
+	static std::mutex lock;
+	static std::map<unsigned int, std::vector<sf::Vector2f>> circles;
+
+	std::lock_guard<std::mutex> guard(lock);
+	auto & circle = circles[points];
+	if(circle.empty()) {
+		circle.reserve(points + 1);
+		for(auto i = 0u; i <= points; ++i)
+			circle.emplace_back(std::cos(i * tau / points), std::sin(i * tau / points));
+	}
+	return circle;
+}
 
 
 void circle_chunk::draw(sf::RenderTarget & target, sf::RenderStates states) const {
-	static const auto tau = std::acos(-1.l) * 2;
+	if(rebuild_ring) {
+		ring = &unit_circle(std::max(static_cast<unsigned int>(points), 1u));
+		vertices.resize(ring->size() + 1);
+		for(auto i = 0u; i < ring->size(); ++i)
+			vertices[i] = {(*ring)[i], clr};
+		rebuild_ring = false;
+		move_end     = true;
+	}
 
-	if(recompute_next_time) {
-		vertices.resize(points);
-		for(auto i = 0.; i < points; ++i)
-			vertices[i] = {{static_cast<float>(r * std::cos(i / points * fract * tau)), static_cast<float>(r * std::sin(i / points * fract * tau))}, clr};
-		recompute_next_time = false;
+	if(move_end) {
+		// The arc's end is the only vertex not straight from the ring, put back whichever one it replaced last time
+		if(end_index < ring->size())
+			vertices[end_index].position = (*ring)[end_index];
+
+		const auto whole_steps = std::min(static_cast<std::size_t>(fract * (ring->size() - 1)), ring->size() - 1);
+		end_index              = whole_steps + 1;
+		vertices[end_index]    = {{std::cos(fract * tau), std::sin(fract * tau)}, clr};
+		move_end               = false;
 	}
 
 	states.transform *= getTransform();
-	target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::LineStrip, states);
+	states.transform.scale(r, r);
+	target.draw(vertices.data(), end_index + 1, sf::PrimitiveType::LineStrip, states);
 }
 
-circle_chunk::circle_chunk(float frcn, float rad, unsigned int np) : fract(frcn), r(rad), points(np), recompute_next_time(true) {}
+circle_chunk::circle_chunk(float frcn, float rad, unsigned int np)
+      : fract(std::min(std::max(frcn, 0.f), 1.f)), r(rad), points(np), ring(nullptr), rebuild_ring(true), move_end(true), end_index(-1) {}
 
 float circle_chunk::radius() const {
 	return r;
 }
 
 void circle_chunk::radius(float new_radius) {
-	r                   = new_radius;
-	recompute_next_time = true;
+	r = new_radius;
 }
 
 float circle_chunk::point_amount() const {
@@ -55,8 +88,8 @@ float circle_chunk::point_amount() const {
 }
 
 void circle_chunk::point_amount(float new_point_amount) {
-	points              = new_point_amount;
-	recompute_next_time = true;
+	points       = new_point_amount;
+	rebuild_ring = true;
 }
 
 float circle_chunk::fraction() const {
@@ -64,8 +97,11 @@ float circle_chunk::fraction() const {
 }
 
 void circle_chunk::fraction(float new_fraction) {
-	fract               = new_fraction;
-	recompute_next_time = true;
+	new_fraction = std::min(std::max(new_fraction, 0.f), 1.f);
+	if(new_fraction != fract) {
+		fract    = new_fraction;
+		move_end = true;
+	}
 }
 
 
@@ -74,6 +110,6 @@ const sf::Color & circle_chunk::colour() const {
 }
 
 void circle_chunk::colour(sf::Color new_colour) {
-	clr                 = std::move(new_colour);
-	recompute_next_time = true;
+	clr          = std::move(new_colour);
+	rebuild_ring = true;
 }
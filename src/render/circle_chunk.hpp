@@ -24,15 +24,23 @@
 
 
 #include <SFML/Graphics.hpp>
+#include <vector>
 
 
+/// An arc of `fraction` of a circle, starting at angle 0
+///
+/// The full ring is built once from a shared unit circle table and scaled to the radius when drawing,
+/// so changing the fraction only moves the arc's end, and changing the radius touches no vertices at all
 class circle_chunk : public sf::Drawable, public sf::Transformable {
 private:
 	float fract;
 	float r;
 	float points;
 	sf::Color clr;
-	mutable bool recompute_next_time;
+	mutable const std::vector<sf::Vector2f> * ring;
+	mutable bool rebuild_ring;
+	mutable bool move_end;
+	mutable std::size_t end_index;
 	mutable std::vector<sf::Vertex> vertices;
 
 protected:
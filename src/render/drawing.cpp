@@ -22,19 +22,29 @@
 
 #include "drawing.hpp"
 #include "../reference/container.hpp"
+#include "drawing_cache.hpp"
 #include "../util/vector.hpp"
-#include <fstream>
+#include <algorithm>
 #include <iterator>
 #include <jsonpp/parser.hpp>
 
 
-drawing::drawing(const std::string & model_name, const sf::Vector2f & window_size) : own_scale(1, 1) {
-	std::ifstream drawing_file(drawing_root + "/" + model_name + ".json");
+drawing::model drawing::load_model(const std::string & model_name) {
+	return parse_model(packed_assets.read(drawing_root + "/" + model_name + ".json"));
+}
+
+drawing::model drawing::parse_model(const std::string & contents) {
 	json::value doc;
-	json::parse(drawing_file, doc);
+	json::parse(contents, doc);
+
+	model mdl;
+	auto & lines      = mdl.lines;
+	auto & triangles  = mdl.triangles;
+	auto & rectangles = mdl.rectangles;
+	auto & curves     = mdl.curves;
 
-	origin_size = {doc["origin_size"]["x"].as<float>(), doc["origin_size"]["y"].as<float>()};
-	loaded_size = {doc["size"]["x"].as<float>(), doc["size"]["y"].as<float>()};
+	mdl.origin_size = {doc["origin_size"]["x"].as<float>(), doc["origin_size"]["y"].as<float>()};
+	mdl.size        = {doc["size"]["x"].as<float>(), doc["size"]["y"].as<float>()};
 
 	for(auto && element : doc["elements"].as<json::array>()) {
 		auto && type = element["type"].as<std::string>();
@@ -87,59 +97,90 @@ drawing::drawing(const std::string & model_name, const sf::Vector2f & window_siz
 		}
 	}
 
-	scale_size(window_size);
+	return mdl;
 }
 
-void drawing::draw(sf::RenderTarget & target, sf::RenderStates states) const {
-	for(auto && line : lines)
-		target.draw(line.data(), line.size(), sf::PrimitiveType::Lines);
-	for(auto && triangle : triangles)
-		target.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
-	for(auto && rectangle : rectangles)
-		target.draw(rectangle.data(), rectangle.size(), sf::PrimitiveType::LineStrip);
-	for(auto && curve : curves)
-		curve.draw(target, states);
-}
+drawing::compiled drawing::compile(const model & mdl, sf::Vector2f window_size) {
+	compiled cmpl;
+	cmpl.size  = mdl.size;
+	cmpl.scale = window_size / mdl.origin_size;
+
+	auto & line_vertices = cmpl.line_vertices;
+	line_vertices.reserve(mdl.lines.size() * 2 + mdl.rectangles.size() * 8);
+	for(auto && line : mdl.lines)
+		line_vertices.insert(line_vertices.end(), line.begin(), line.end());
+	for(auto && rectangle : mdl.rectangles)
+		for(auto i = 1u; i < rectangle.size(); ++i) {
+			line_vertices.emplace_back(rectangle[i - 1]);
+			line_vertices.emplace_back(rectangle[i]);
+		}
 
-void drawing::move(float x, float y) {
-	sf::Vector2f offset(x, y);
+	// Curves are tessellated at the scale they'll be drawn at, but placed by the transform like everything else
+	for(auto curve : mdl.curves) {
+		curve.setScale(cmpl.scale);
+		const auto & strip = curve.line_strip();
+		for(auto i = 1u; i < strip.size(); ++i) {
+			line_vertices.emplace_back(strip[i - 1]);
+			line_vertices.emplace_back(strip[i]);
+		}
+	}
+	line_vertices.shrink_to_fit();
+
+	auto & triangle_vertices = cmpl.triangle_vertices;
+	triangle_vertices.reserve(mdl.triangles.size() * 3);
+	for(auto && triangle : mdl.triangles)
+		triangle_vertices.insert(triangle_vertices.end(), triangle.begin(), triangle.end());
 
-	for(auto && line : lines)
-		for(auto && point : line)
-			point.position += offset;
+	return cmpl;
+}
 
-	for(auto && triangle : triangles)
-		for(auto && point : triangle)
-			point.position += offset;
+void drawing::replace_model(const std::string & name, const model & mdl) {
+	forget_cached_drawing(name);
+	for(auto && drw : live_drawings())
+		if(drw->model_name == name) {
+			drw->compiled_model = std::make_shared<compiled>(compile(mdl, drw->window_size));
+			drw->place();
+		}
+}
 
-	for(auto && rectangle : rectangles)
-		for(auto && point : rectangle)
-			point.position += offset;
+std::vector<drawing *> & drawing::live_drawings() {
+	static std::vector<drawing *> live;
+	return live;
+}
 
-	for(auto && curve : curves)
-		curve.move(x, y);
+drawing::drawing(const std::string & name, const sf::Vector2f & wsize)
+      : model_name(name), window_size(wsize), compiled_model(cached_drawing(model_name, window_size)) {
+	place();
+	live_drawings().emplace_back(this);
 }
 
-void drawing::scale_size(sf::Vector2f factor) {
-	factor    = factor / origin_size;
-	own_scale = own_scale * factor;
+drawing::drawing(const drawing & other)
+      : sf::Drawable(other), model_name(other.model_name), window_size(other.window_size), offset(other.offset), compiled_model(other.compiled_model),
+        placement(other.placement) {
+	live_drawings().emplace_back(this);
+}
 
-	for(auto && line : lines)
-		for(auto && point : line)
-			point.position = point.position * factor;
+drawing::~drawing() {
+	auto & live = live_drawings();
+	live.erase(std::find(live.begin(), live.end(), this));
+}
 
-	for(auto && triangle : triangles)
-		for(auto && point : triangle)
-			point.position = point.position * factor;
+void drawing::draw(sf::RenderTarget & target, sf::RenderStates states) const {
+	states.transform *= placement;
+	target.draw(compiled_model->line_vertices.data(), compiled_model->line_vertices.size(), sf::PrimitiveType::Lines, states);
+	target.draw(compiled_model->triangle_vertices.data(), compiled_model->triangle_vertices.size(), sf::PrimitiveType::Triangles, states);
+}
 
-	for(auto && rectangle : rectangles)
-		for(auto && point : rectangle)
-			point.position = point.position * factor;
+void drawing::move(float x, float y) {
+	offset += {x, y};
+	place();
+}
 
-	for(auto && curve : curves)
-		curve.scale(factor);
+void drawing::place() {
+	placement = sf::Transform::Identity;
+	placement.translate(offset).scale(compiled_model->scale);
 }
 
 sf::Vector2f drawing::size() const {
-	return loaded_size * own_scale;
+	return compiled_model->size * compiled_model->scale;
 }
@@ -26,31 +26,62 @@
 #include "bezier_curve.hpp"
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <memory>
+#include <string>
 #include <vector>
 
 
+/// A drawing file, compiled into one vertex buffer of lines and one of triangles, placed and scaled by a transform
 class drawing : public sf::Drawable {
 public:
 	using line      = std::array<sf::Vertex, 2>;
 	using triangle  = std::array<sf::Vertex, 3>;
 	using rectangle = std::array<sf::Vertex, 5>;
 
+	/// A drawing file's contents, before scaling
+	struct model {
+		sf::Vector2f origin_size;
+		sf::Vector2f size;
+		std::vector<line> lines;
+		std::vector<triangle> triangles;
+		std::vector<rectangle> rectangles;
+		std::vector<bezier_curve> curves;
+	};
+
+	/// A model scaled to a window and flattened into vertex buffers, positioned at the origin
+	struct compiled {
+		sf::Vector2f size;
+		sf::Vector2f scale;
+		std::vector<sf::Vertex> line_vertices;
+		std::vector<sf::Vertex> triangle_vertices;
+	};
+
+	/// Parse a drawing file's contents, throws on malformed ones
+	static model parse_model(const std::string & contents);
+	/// Read and parse a drawing file, throws on malformed ones
+	static model load_model(const std::string & model_name);
+	static compiled compile(const model & mdl, sf::Vector2f window_size);
+	/// Rebuild every live drawing of the specified model, keeping its placement; main thread only
+	static void replace_model(const std::string & model_name, const model & mdl);
+
 private:
-	sf::Vector2f origin_size;
-	sf::Vector2f loaded_size;
-	std::vector<line> lines;
-	std::vector<triangle> triangles;
-	std::vector<rectangle> rectangles;
-	std::vector<bezier_curve> curves;
+	std::string model_name;
+	sf::Vector2f window_size;
+	sf::Vector2f offset;
+	std::shared_ptr<const compiled> compiled_model;
+	sf::Transform placement;
 
-	void scale_size(sf::Vector2f factor);
+	static std::vector<drawing *> & live_drawings();
 
-public:
-	sf::Vector2f own_scale;
+	void place();
 
+public:
 	drawing(const std::string & model_name, const sf::Vector2f & window_size);
 	template <class T>
 	drawing(const std::string & model_name, const sf::Vector2<T> & window_size);
+	drawing(const drawing & other);
+	drawing & operator=(const drawing & other) = default;
+	virtual ~drawing();
 
 	virtual void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
 
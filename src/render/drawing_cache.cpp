@@ -0,0 +1,155 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "drawing_cache.hpp"
+#include "../reference/container.hpp"
+#include "../util/file.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+
+// Layout, native-endian: u64 file hash, f32 window size x, y, f32 size x, y, f32 scale x, y, u64 line vertex count, u64 triangle vertex count,
+// then the line and triangle sf::Vertexes as they are in memory
+struct cache_header {
+	std::uint64_t hash;
+	sf::Vector2f window_size;
+	sf::Vector2f size;
+	sf::Vector2f scale;
+	std::uint64_t line_vertices;
+	std::uint64_t triangle_vertices;
+};
+
+
+static std::uint64_t fnv1a(const std::string & data) {
+	std::uint64_t hash = 0xCBF29CE484222325;
+	for(auto c : data) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+static std::shared_ptr<drawing::compiled> read_cache(const std::string & path, std::uint64_t hash, sf::Vector2f window_size) {
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if(!file)
+		return nullptr;
+
+	std::string data(static_cast<std::size_t>(file.tellg()), '\0');
+	file.seekg(0);
+	if(!file.read(&data[0], data.size()) || data.size() < sizeof(cache_header))
+		return nullptr;
+
+	cache_header header;
+	std::memcpy(&header, data.data(), sizeof(header));
+	if(header.hash != hash || header.window_size != window_size ||
+	   data.size() != sizeof(header) + (header.line_vertices + header.triangle_vertices) * sizeof(sf::Vertex))
+		return nullptr;
+
+	auto cmpl   = std::make_shared<drawing::compiled>();
+	cmpl->size  = header.size;
+	cmpl->scale = header.scale;
+	cmpl->line_vertices.resize(header.line_vertices);
+	cmpl->triangle_vertices.resize(header.triangle_vertices);
+	std::memcpy(cmpl->line_vertices.data(), data.data() + sizeof(header), header.line_vertices * sizeof(sf::Vertex));
+	std::memcpy(cmpl->triangle_vertices.data(), data.data() + sizeof(header) + header.line_vertices * sizeof(sf::Vertex),
+	            header.triangle_vertices * sizeof(sf::Vertex));
+	return cmpl;
+}
+
+static void write_cache(const std::string & path, std::uint64_t hash, sf::Vector2f window_size, const drawing::compiled & cmpl) {
+	// Written aside and renamed over, so a crash or a concurrent read never sees half a file
+	const auto temp_path = fmt::format("{}.{:016x}-{}x{}.tmp", path, hash, window_size.x, window_size.y);
+	const cache_header header{hash, window_size, cmpl.size, cmpl.scale, cmpl.line_vertices.size(), cmpl.triangle_vertices.size()};
+	{
+		std::ofstream file(temp_path, std::ios::binary);
+		file.write(reinterpret_cast<const char *>(&header), sizeof(header))
+		    .write(reinterpret_cast<const char *>(cmpl.line_vertices.data()), cmpl.line_vertices.size() * sizeof(sf::Vertex))
+		    .write(reinterpret_cast<const char *>(cmpl.triangle_vertices.data()), cmpl.triangle_vertices.size() * sizeof(sf::Vertex));
+		if(!file.flush()) {
+			file.close();
+			std::remove(temp_path.c_str());
+			return;
+		}
+	}
+
+	if(std::rename(temp_path.c_str(), path.c_str())) {  // Windows won't rename over an existing file
+		std::remove(path.c_str());
+		if(std::rename(temp_path.c_str(), path.c_str()))
+			std::remove(temp_path.c_str());
+	}
+}
+
+
+// Packed models can't change under a running game, loose ones are compiled anew when they've been modified since
+struct in_memory_drawing {
+	std::shared_ptr<const drawing::compiled> compiled;
+	bool packed;
+	std::time_t modified;
+};
+
+static std::mutex in_memory_lock;
+static std::unordered_map<std::string, in_memory_drawing> in_memory;
+
+static std::string in_memory_key(const std::string & model_name, sf::Vector2f window_size) {
+	return fmt::format("{}/{}x{}", model_name, window_size.x, window_size.y);
+}
+
+
+std::shared_ptr<const drawing::compiled> cached_drawing(const std::string & model_name, sf::Vector2f window_size) {
+	const auto model_path = drawing_root + "/" + model_name + ".json";
+	const auto packed     = static_cast<bool>(packed_assets.find(model_path));
+	const auto modified   = packed ? 0 : file_modification_time(model_path);
+
+	std::lock_guard<std::mutex> guard(in_memory_lock);
+	auto & cmpl = in_memory[in_memory_key(model_name, window_size)];
+	if(cmpl.compiled && cmpl.packed == packed && cmpl.modified == modified)
+		return cmpl.compiled;
+
+	const auto contents = packed_assets.read(model_path);
+	const auto hash     = fnv1a(contents);
+	const auto path     = cache_root + '/' + model_name + ".drawing";
+	cmpl.packed         = packed;
+	cmpl.modified       = modified;
+	if(auto from_disk = read_cache(path, hash, window_size))
+		cmpl.compiled = std::move(from_disk);
+	else {
+		auto compiled = std::make_shared<const drawing::compiled>(drawing::compile(drawing::parse_model(contents), window_size));
+		background_jobs.submit(job_priority::io, [path, hash, window_size, compiled] { write_cache(path, hash, window_size, *compiled); });
+		cmpl.compiled = std::move(compiled);
+	}
+	return cmpl.compiled;
+}
+
+void forget_cached_drawing(const std::string & model_name) {
+	std::lock_guard<std::mutex> guard(in_memory_lock);
+	const auto prefix = model_name + '/';
+	for(auto itr = in_memory.begin(); itr != in_memory.end();)
+		if(itr->first.compare(0, prefix.size(), prefix) == 0)
+			itr = in_memory.erase(itr);
+		else
+			++itr;
+}
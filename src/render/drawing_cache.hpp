@@ -0,0 +1,39 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "drawing.hpp"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+
+
+/// The named drawing compiled for the specified window size
+///
+/// Compiled drawings are kept in memory by name and window size, until a loose drawing file's modification time changes,
+/// and in cache_root as one file per drawing, valid while the FNV-1a hash of the drawing file and the window size stored in it match,
+/// so the file is only parsed again after it changes
+std::shared_ptr<const drawing::compiled> cached_drawing(const std::string & model_name, sf::Vector2f window_size);
+/// Drop the in-memory copies of the named drawing, for after its file's been changed
+void forget_cached_drawing(const std::string & model_name);
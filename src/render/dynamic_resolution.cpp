@@ -0,0 +1,93 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "dynamic_resolution.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+
+
+// Frame time over target frame time: the scale goes down when the average is over late_load,
+// and up when upscale_after frames in a row were all under on_time_load
+static const constexpr auto late_load      = 1.05f;
+static const constexpr auto on_time_load   = 1.02f;
+static const constexpr auto upscale_after  = 120u;
+static const constexpr auto downscale_step = .9f;
+static const constexpr auto upscale_step   = 1.05f;
+static const constexpr auto load_smoothing = .1f;
+
+
+void dynamic_resolution::adjust(std::chrono::steady_clock::duration frame) {
+	const auto load = std::chrono::duration<float>(frame) / std::chrono::duration<float>(target_frame);
+	average_load += (load - average_load) * load_smoothing;
+
+	if(average_load > late_load) {
+		scale          = std::max(scale * downscale_step, min_scale);
+		average_load   = 1;  // Give the new scale a chance to show its effect before going down again
+		frames_on_time = 0;
+	} else if(load > on_time_load)
+		frames_on_time = 0;
+	else if(++frames_on_time >= upscale_after) {
+		scale          = std::min(scale * upscale_step, max_scale);
+		frames_on_time = 0;
+	}
+}
+
+sf::RenderTarget & dynamic_resolution::begin() {
+	const auto now = std::chrono::steady_clock::now();
+	if(last_frame != std::chrono::steady_clock::time_point{})
+		adjust(now - last_frame);
+	last_frame = now;
+
+	const auto texture_size = static_cast<sf::Vector2f>(texture.getSize());
+	sf::View view({0, 0, window_size.x, window_size.y});
+	view.setViewport({0, 0, window_size.x * scale / texture_size.x, window_size.y * scale / texture_size.y});
+	texture.setView(view);
+	texture.clear(sf::Color::Black);
+	return texture;
+}
+
+void dynamic_resolution::present(sf::RenderTarget & target) {
+	texture.display();
+
+	const sf::Vector2i rendered_size(std::round(window_size.x * scale), std::round(window_size.y * scale));
+	upscaled.setTextureRect({{0, 0}, rendered_size});
+	upscaled.setScale(window_size.x / rendered_size.x, window_size.y / rendered_size.y);
+	target.draw(upscaled);
+}
+
+float dynamic_resolution::current_scale() const noexcept {
+	return scale;
+}
+
+std::string dynamic_resolution::summary() const {
+	return fmt::format("Dynamic resolution: scale {:.2f} ({:.2f}-{:.2f})", scale, min_scale, max_scale);
+}
+
+dynamic_resolution::dynamic_resolution(sf::Vector2u wsize, unsigned int target_FPS, float min_s, float max_s)
+      : window_size(wsize), min_scale(std::max(std::min(min_s, max_s), .05f)), max_scale(std::max(max_s, min_scale)), scale(max_scale),
+        target_frame(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(1.f / std::max(target_FPS, 1u)))),
+        average_load(1), frames_on_time(0) {
+	texture.create(std::ceil(wsize.x * max_scale), std::ceil(wsize.y * max_scale));
+	texture.setSmooth(true);
+	upscaled.setTexture(texture.getTexture());
+}
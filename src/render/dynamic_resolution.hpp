@@ -0,0 +1,62 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <string>
+
+
+/// Renders into an offscreen texture at a fraction of the window's resolution, upscaled to the window when presented
+///
+/// SFML has no GPU timer queries, so the fraction follows the frame interval instead:
+/// it goes down as soon as frames run late on average, and creeps back up after a while of them being on time
+class dynamic_resolution {
+private:
+	sf::RenderTexture texture;
+	sf::Sprite upscaled;
+	sf::Vector2f window_size;
+	float min_scale;
+	float max_scale;
+	float scale;
+
+	std::chrono::steady_clock::duration target_frame;
+	std::chrono::steady_clock::time_point last_frame;
+	float average_load;
+	unsigned int frames_on_time;
+
+	void adjust(std::chrono::steady_clock::duration frame);
+
+public:
+	/// Start a frame, returning what to draw it onto, with the same coordinates as the window
+	sf::RenderTarget & begin();
+	/// Upscale the frame onto `target`
+	void present(sf::RenderTarget & target);
+
+	float current_scale() const noexcept;
+	/// "Dynamic resolution: scale X (min-max)"
+	std::string summary() const;
+
+	dynamic_resolution(sf::Vector2u window_size, unsigned int target_FPS, float min_scale, float max_scale);
+};
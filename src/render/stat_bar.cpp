@@ -31,7 +31,7 @@ const sf::Texture & stat_bar::load_bar_frame_texture() {
 	static bool bar_frame_texture_loaded = false;
 
 	if(!bar_frame_texture_loaded)
-		bar_frame_texture_loaded = bar_frame_texture.loadFromFile(textures_root + "/gui/game/stat_bar_frame.png");
+		bar_frame_texture_loaded = packed_assets.load_into(bar_frame_texture, textures_root + "/gui/game/stat_bar_frame.png");
 	return bar_frame_texture;
 }
 
@@ -40,7 +40,7 @@ const sf::Texture & stat_bar::load_bar_fill_texture() {
 	static bool bar_fill_texture_loaded = false;
 
 	if(!bar_fill_texture_loaded)
-		bar_fill_texture_loaded = bar_fill_texture.loadFromFile(textures_root + "/gui/game/stat_bar_fill.png");
+		bar_fill_texture_loaded = packed_assets.load_into(bar_fill_texture, textures_root + "/gui/game/stat_bar_fill.png");
 	return bar_fill_texture;
 }
 
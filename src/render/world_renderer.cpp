@@ -0,0 +1,90 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "world_renderer.hpp"
+#include "../reference/container.hpp"
+
+
+static const sf::Color progress_colour(255, 255, 255, 100);
+static const sf::Color body_colour(231, 158, 109);
+static const sf::Color armour_colour(200, 200, 200);
+static const sf::Vertex player_shape[]{
+    {{-1, 0}, body_colour},     //
+    {{0, -1}, body_colour},     //
+    {{1, 0}, body_colour},      //
+    {{0, 1}, body_colour},      //
+    {{-2, -2}, armour_colour},  //
+    {{2, -2}, armour_colour},   //
+    {{2, 2}, armour_colour},    //
+    {{-2, 2}, armour_colour},   //
+};
+
+
+world_renderer::world_renderer() : progress_circle(0, 7) {
+	progress_circle.colour(progress_colour);
+}
+
+void world_renderer::draw(const world_snapshot & snapshot, sf::RenderTarget & target, sf::RenderStates states) {
+	static const auto constexpr bullet_k = 2.5f;
+
+	bullet_vertices.clear();
+	for(auto && bullet : snapshot.bullets) {
+		bullet_vertices.emplace_back(sf::Vector2f{bullet.x, bullet.y}, sf::Color::White);
+		bullet_vertices.emplace_back(sf::Vector2f{bullet.x + bullet.motion_x * bullet_k, bullet.y + bullet.motion_y * bullet_k}, sf::Color::White);
+	}
+	target.draw(bullet_vertices.data(), bullet_vertices.size(), sf::PrimitiveType::Lines, states);
+
+	player_vertices.clear();
+	for(auto && player : snapshot.players) {
+		sf::Transform transform;
+		transform.translate(player.x, player.y).rotate(player.rotation);
+		for(auto && vertex : player_shape)
+			player_vertices.emplace_back(transform.transformPoint(vertex.position), vertex.color);
+	}
+	target.draw(player_vertices.data(), player_vertices.size(), sf::PrimitiveType::Points, states);
+
+	for(auto && player : snapshot.players)
+		if(player.gun_progress != 1) {
+			progress_circle.fraction(player.gun_progress);
+			progress_circle.setPosition(player.x, player.y);
+			progress_circle.setRotation(player.gun_progress * 360);
+			target.draw(progress_circle, states);
+		}
+}
+
+void world_renderer::draw_labels(const world_snapshot & snapshot, sf::RenderTarget & target, sf::RenderStates states) {
+	if(gun_name_popups.size() < snapshot.players.size())
+		gun_name_popups.resize(snapshot.players.size(), sf::Text("", font_pixelish, 10));
+	for(auto i = 0u; i < snapshot.players.size(); ++i) {
+		auto && player = snapshot.players[i];
+		if(!player.gun_name_shown)
+			continue;
+
+		auto & popup = gun_name_popups[i];
+		popup.setString(player.gun_name);
+		popup.setFillColor({255, 255, 255, player.gun_name_alpha});
+
+		const auto & size = popup.getLocalBounds();
+		popup.setPosition(player.x - size.width / 2., player.y - size.height * 2);
+		target.draw(popup, states);
+	}
+}
@@ -0,0 +1,46 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "../game/world_snapshot.hpp"
+#include "circle_chunk.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+
+/// Draws world_snapshots, keeping the render-side objects around between frames
+class world_renderer {
+private:
+	std::vector<sf::Vertex> bullet_vertices;
+	std::vector<sf::Vertex> player_vertices;
+	circle_chunk progress_circle;
+	std::vector<sf::Text> gun_name_popups;
+
+public:
+	world_renderer();
+
+	void draw(const world_snapshot & snapshot, sf::RenderTarget & target, sf::RenderStates states = sf::RenderStates::Default);
+	/// Text over the world, separate so it can be drawn at full resolution when the rest isn't
+	void draw_labels(const world_snapshot & snapshot, sf::RenderTarget & target, sf::RenderStates states = sf::RenderStates::Default);
+};
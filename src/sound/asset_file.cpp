@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "asset_file.hpp"
+#include "../reference/container.hpp"
+#include <algorithm>
+#include <cstring>
+
+
+namespace {
+	class packed_file : public audiere::RefImplementation<audiere::File> {
+	private:
+		asset_archive::view data;
+		int position;
+
+	public:
+		ADR_METHOD(int) read(void * buffer, int size) override;
+		ADR_METHOD(bool) seek(int pos, SeekMode mode) override;
+		ADR_METHOD(int) tell() override;
+
+		explicit packed_file(asset_archive::view data);
+	};
+}
+
+
+audiere::FilePtr open_asset_file(const std::string & path) {
+	if(const auto packed = packed_assets.find(path))
+		return new packed_file(packed);
+	else
+		return audiere::OpenFile(path.c_str(), false);
+}
+
+
+int packed_file::read(void * buffer, int size) {
+	const auto to_read = std::max(std::min(size, static_cast<int>(data.size) - position), 0);
+	std::memcpy(buffer, data.data + position, to_read);
+	position += to_read;
+	return to_read;
+}
+
+bool packed_file::seek(int pos, SeekMode mode) {
+	switch(mode) {
+		case BEGIN:
+			break;
+		case CURRENT:
+			pos += position;
+			break;
+		case END:
+			pos += data.size;
+			break;
+		default:
+			return false;
+	}
+
+	if(pos < 0 || pos > static_cast<int>(data.size))
+		return false;
+	position = pos;
+	return true;
+}
+
+int packed_file::tell() {
+	return position;
+}
+
+packed_file::packed_file(asset_archive::view d) : data(d), position(0) {}
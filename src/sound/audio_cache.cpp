@@ -0,0 +1,76 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "audio_cache.hpp"
+#include "../reference/container.hpp"
+#include "asset_file.hpp"
+#include <fmt/format.h>
+
+
+void audio_cache::evict(const std::string & path) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	// Another buffer() may have already replaced the expired entry with a fresh one
+	const auto itr = buffers.find(path);
+	if(itr != buffers.end() && itr->second.expired()) {
+		buffers.erase(itr);
+		++stats.evicted;
+	}
+}
+
+audio_cache::handle audio_cache::buffer(const std::string & path) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	const auto itr = buffers.find(path);
+	if(itr != buffers.end())
+		if(auto cached = itr->second.lock()) {
+			++stats.hits;
+			return cached;
+		}
+
+	audiere::SampleBufferPtr decoded;
+	if(const audiere::SampleSourcePtr source = audiere::OpenSampleSource(open_asset_file(path)))
+		decoded = audiere::CreateSampleBuffer(source);
+
+	// Failures are held onto too, so a missing file isn't looked for again every time while anything still wants it
+	++(decoded ? stats.decoded : stats.failed);
+	handle held(new audiere::SampleBufferPtr(decoded), [this, path](const audiere::SampleBufferPtr * buf) {
+		delete buf;
+		evict(path);
+	});
+	buffers[path] = held;
+	return held;
+}
+
+audio_cache::statistics audio_cache::statistics_so_far() {
+	std::lock_guard<std::mutex> guard(lock);
+	auto st     = stats;
+	st.resident = buffers.size();
+	return st;
+}
+
+std::string audio_cache::summary() {
+	const auto st = statistics_so_far();
+	return fmt::format("Audio cache: {} files decoded, {} failed, {} hits, {} evicted, {} resident", st.decoded, st.failed, st.hits, st.evicted, st.resident);
+}
+
+audio_cache::audio_cache() : stats{0, 0, 0, 0, 0} {}
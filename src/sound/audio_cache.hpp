@@ -0,0 +1,64 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <audiere.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+/// Process-wide store of decoded sounds, so every file is read and decoded once no matter how many entities use it. Thread-safe.
+///
+/// Sounds are refcounted by their handles: one stays decoded for as long as anything holds a handle to it and is evicted when the last one's dropped.
+class audio_cache {
+public:
+	/// The whole file, decoded; points to nullptr if it couldn't be
+	using handle = std::shared_ptr<const audiere::SampleBufferPtr>;
+
+	struct statistics {
+		std::size_t decoded;
+		std::size_t failed;
+		std::size_t hits;
+		std::size_t evicted;
+		std::size_t resident;
+	};
+
+private:
+	std::mutex lock;
+	std::unordered_map<std::string, std::weak_ptr<const audiere::SampleBufferPtr>> buffers;
+	statistics stats;
+
+	void evict(const std::string & path);
+
+public:
+	handle buffer(const std::string & path);
+
+	statistics statistics_so_far();
+	/// "Audio cache: X files decoded, Y failed, Z hits, W evicted, V resident"
+	std::string summary();
+
+	audio_cache();
+};
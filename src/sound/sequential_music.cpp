@@ -22,45 +22,76 @@
 
 #include "sequential_music.hpp"
 #include "../reference/container.hpp"
+#include "asset_file.hpp"
 #include <algorithm>
+#include <chrono>
 
 
-sequential_music::sequential_music() : getter_algo([](auto) { return ""; }) {}
+sequential_music::sequential_music()
+      : loop(true), started(false), music_id(0), max_id(0), getter_algo([](auto) { return ""; }), volume(1), pan(0), pitch_shift(1) {}
 sequential_music::sequential_music(unsigned int seq_len, std::function<std::string(unsigned int)> getter)
-      : loop(true), output_stream(nullptr), music_id(0), max_id(seq_len - 1), getter_algo(getter), volume(1), pan(0), pitch_shift(1) {
+      : loop(true), started(false), output_stream(nullptr), music_id(0), max_id(seq_len - 1), getter_algo(getter), volume(1), pan(0), pitch_shift(1) {
 	if(seq_len)
-		output_stream = audiere::OpenSound(audio_device, getter(0).c_str(), true);
+		open_next(0);
 }
 sequential_music::sequential_music(unsigned int maximal_id, const std::string & filename)
       : sequential_music(maximal_id, [=](unsigned int) { return filename; }) {}
 
+void sequential_music::open_next(unsigned int id) {
+	next_stream.first  = id;
+	// The device is resolved here, as a job waiting on another job could deadlock a pool with one worker
+	next_stream.second = background_jobs.submit(job_priority::io, [device = audio_device.get(), fname = getter_algo(id) ] {
+		return audiere::OutputStreamPtr(audiere::OpenSound(device, open_asset_file(fname), true));
+	});
+}
+
+void sequential_music::open_after_current() {
+	auto id = std::min(music_id + 1, max_id);
+	if(id == max_id) {
+		if(getRepeat())
+			id = 0;
+		else {
+			next_stream.second = {};
+			return;
+		}
+	}
+
+	open_next(id);
+}
+
 void sequential_music::tick() {
-	if(!output_stream || isPlaying())
+	if(!started || isPlaying())
 		return;
 	go_to_next();
 }
 
 void sequential_music::go_to_next() {
+	if(!next_stream.second.valid()) {
+		stop();
+		output_stream = nullptr;
+		started       = false;
+		return;
+	}
+
+	// Not open yet, this'll be retried next tick
+	if(next_stream.second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return;
+
 	stop();
+	music_id      = next_stream.first;
+	output_stream = next_stream.second.get();
+	open_after_current();
 
-	music_id = std::min(music_id + 1, max_id);
-	if(music_id == max_id) {
-		if(getRepeat())
-			music_id = 0;
-		else {
-			output_stream = nullptr;
-			return;
-		}
+	if(output_stream) {
+		output_stream->setVolume(volume);
+		output_stream->setPan(pan);
+		output_stream->setPitchShift(pitch_shift);
+		output_stream->play();
 	}
-
-	output_stream = audiere::OpenSound(audio_device, getter_algo(music_id).c_str(), true);
-	output_stream->setVolume(volume);
-	output_stream->setPan(pan);
-	output_stream->setPitchShift(pitch_shift);
-	play();
 }
 
 void sequential_music::play() {
+	started = true;
 	if(output_stream)
 		output_stream->play();
 }
@@ -81,43 +112,44 @@ void sequential_music::reset() {
 
 void sequential_music::setRepeat(bool repeat) {
 	loop = repeat;
+	if(output_stream)
+		open_after_current();
 }
 
 bool sequential_music::getRepeat() {
 	return loop;
 }
 
+// These are remembered even before the first track's open, and carried over to the following ones
+
 void sequential_music::setVolume(float new_volume) {
-	if(output_stream) {
-		volume = new_volume;
+	volume = new_volume;
+	if(output_stream)
 		output_stream->setVolume(volume);
-	}
 }
 
 float sequential_music::getVolume() {
-	return output_stream ? output_stream->getVolume() : 0;
+	return volume;
 }
 
 void sequential_music::setPan(float new_pan) {
-	if(output_stream) {
-		pan = new_pan;
+	pan = new_pan;
+	if(output_stream)
 		output_stream->setPan(pan);
-	}
 }
 
 float sequential_music::getPan() {
-	return output_stream ? output_stream->getPan() : 0;
+	return pan;
 }
 
 void sequential_music::setPitchShift(float new_shift) {
-	if(output_stream) {
-		pitch_shift = new_shift;
+	pitch_shift = new_shift;
+	if(output_stream)
 		output_stream->setPitchShift(pitch_shift);
-	}
 }
 
 float sequential_music::getPitchShift() {
-	return output_stream ? output_stream->getPitchShift() : 0;
+	return pitch_shift;
 }
 
 bool sequential_music::isSeekable() {
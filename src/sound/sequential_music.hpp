@@ -24,25 +24,36 @@
 
 
 #include <audiere.h>
+#include <functional>
+#include <future>
 #include <memory>
+#include <string>
 
 
+/// Plays a sequence of tracks, each opened on background_jobs while the one before it plays; the first one starts playing once it's open
 class sequential_music : public audiere::RefImplementation<audiere::OutputStream> {
 private:
 	bool loop;
+	bool started;
 	audiere::OutputStreamPtr output_stream;
 	unsigned int music_id;
 	unsigned int max_id;
 	std::function<std::string(unsigned int)> getter_algo;
+	std::pair<unsigned int, std::future<audiere::OutputStreamPtr>> next_stream;
 
 	float volume;
 	float pan;
 	float pitch_shift;
 
+	void open_next(unsigned int id);
+	void open_after_current();
+
 public:
 	sequential_music();
 	sequential_music(unsigned int max_id, std::function<std::string(unsigned int)> getter_algo);
 	sequential_music(unsigned int max_id, const std::string & filename);
+	sequential_music(sequential_music &&) = default;
+	sequential_music & operator=(sequential_music &&) = default;
 	virtual ~sequential_music() = default;
 
 	virtual void tick();
@@ -0,0 +1,147 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "voice_pool.hpp"
+#include "../reference/container.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <iterator>
+#include <tuple>
+
+
+bool voice_pool::admit(const std::string & path, voice_priority priority, const std::pair<bool, game_clock::time_point> & tick,
+                       std::vector<voice>::iterator & victim) {
+	voices.erase(std::remove_if(voices.begin(), voices.end(), [](auto && v) { return !v.stream->isPlaying(); }), voices.end());
+
+	if(tick.first && std::any_of(voices.begin(), voices.end(), [&](auto && v) { return v.tick.first && v.tick.second == tick.second && v.sound == path; })) {
+		++dropped;
+		return false;
+	}
+
+	const auto stealable   = [&](auto && v) { return v.priority <= priority; };
+	const auto steal_order = [](auto && lhs, auto && rhs) {
+		return std::tie(lhs.priority, lhs.volume, lhs.started) < std::tie(rhs.priority, rhs.volume, rhs.started);
+	};
+	const auto pick_victim = [&](auto && filter) {
+		auto picked = voices.end();
+		for(auto itr = voices.begin(); itr != voices.end(); ++itr)
+			if(filter(*itr) && stealable(*itr) && (picked == voices.end() || steal_order(*itr, *picked)))
+				picked = itr;
+		return picked;
+	};
+
+	const auto same_sound = std::count_if(voices.begin(), voices.end(), [&](auto && v) { return v.sound == path; });
+	const auto sound_full = static_cast<std::size_t>(same_sound) >= std::max(app_configuration.max_voices_per_sound, 1u);
+	const auto pool_full  = voices.size() >= std::max(app_configuration.max_voices, 1u);
+
+	victim = voices.end();
+	if(sound_full)
+		victim = pick_victim([&](auto && v) { return v.sound == path; });
+	else if(pool_full)
+		victim = pick_victim([](auto &&) { return true; });
+	if((sound_full || pool_full) && victim == voices.end()) {
+		++dropped;
+		return false;
+	}
+	return true;
+}
+
+bool voice_pool::play_p(const std::string & path, float volume, voice_priority priority, std::pair<bool, game_clock::time_point> tick) {
+	const auto now = std::chrono::steady_clock::now();
+	std::vector<voice>::iterator victim;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if(muted || !admit(path, priority, tick, victim))
+			return false;
+	}
+
+	// Streamed from the decoded buffer, since a non-streaming sound would copy all of it into a fresh device buffer on every play
+	const auto buffer = audio_assets.buffer(path);
+	if(!*buffer)
+		return false;
+	audiere::OutputStreamPtr stream(audiere::OpenSound(audio_device.get(), (*buffer)->openStream(), true));
+	if(!stream)
+		return false;
+
+	std::lock_guard<std::mutex> guard(lock);
+	if(muted || !admit(path, priority, tick, victim))  // Other voices may've started or finished while the stream was being opened
+		return false;
+
+	stream->setVolume(volume * gain);
+	stream->play();
+	if(victim != voices.end()) {
+		victim->stream->stop();
+		*victim = {stream, buffer, path, priority, volume, now, tick};
+		++stolen;
+	} else
+		voices.push_back({stream, buffer, path, priority, volume, now, tick});
+	return true;
+}
+
+bool voice_pool::play(const std::string & path, float volume, voice_priority priority) {
+	return play_p(path, volume, priority, {false, {}});
+}
+
+bool voice_pool::play(const std::string & path, float volume, voice_priority priority, game_clock::time_point tick) {
+	return play_p(path, volume, priority, {true, tick});
+}
+
+audio_cache::handle voice_pool::preload(const std::string & path) {
+	return audio_assets.buffer(path);
+}
+
+std::vector<audio_cache::handle> voice_pool::preload(const std::vector<std::string> & paths) {
+	std::vector<audio_cache::handle> out;
+	out.reserve(paths.size());
+	std::transform(paths.begin(), paths.end(), std::back_inserter(out), [&](auto && path) { return this->preload(path); });
+	return out;
+}
+
+void voice_pool::stop_all() {
+	std::lock_guard<std::mutex> guard(lock);
+	for(auto && v : voices)
+		v.stream->stop();
+	voices.clear();
+}
+
+void voice_pool::mute() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		muted = true;
+	}
+	stop_all();
+}
+
+void voice_pool::duck(float factor) {
+	std::lock_guard<std::mutex> guard(lock);
+	gain = factor;
+	for(auto && v : voices)
+		v.stream->setVolume(v.volume * gain);
+}
+
+std::string voice_pool::summary() {
+	std::lock_guard<std::mutex> guard(lock);
+	return fmt::format("Voices: {} playing, {} stolen, {} dropped", voices.size(), stolen, dropped);
+}
+
+voice_pool::voice_pool() : gain(1), muted(false), dropped(0), stolen(0) {}
@@ -0,0 +1,89 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "../game/game_clock.hpp"
+#include "audio_cache.hpp"
+#include <audiere.h>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/// Higher priorities steal voices from lower ones, never the other way around
+enum class voice_priority : unsigned char {
+	effect,
+	important,
+	interface,
+};
+
+
+/// Plays decoded sounds from audio_assets with a cap on concurrent voices, both per sound and in total.
+///
+/// When a cap's hit, the lowest-priority voice is stolen, the quietest and then the oldest one among equals; if every candidate outranks the new sound
+/// it's dropped instead. Triggers of a sound that's already started on the same game tick are dropped too. Thread-safe.
+class voice_pool {
+private:
+	struct voice {
+		audiere::OutputStreamPtr stream;
+		audio_cache::handle buffer;
+		std::string sound;
+		voice_priority priority;
+		float volume;
+		std::chrono::steady_clock::time_point started;
+		std::pair<bool, game_clock::time_point> tick;
+	};
+
+	std::mutex lock;
+	std::vector<voice> voices;
+	float gain;
+	bool muted;
+	std::size_t dropped;
+	std::size_t stolen;
+
+	/// Whether a new voice for `path` may start now, and which one it'd replace, if any; `lock` must be held
+	bool admit(const std::string & path, voice_priority priority, const std::pair<bool, game_clock::time_point> & tick, std::vector<voice>::iterator & victim);
+	bool play_p(const std::string & path, float volume, voice_priority priority, std::pair<bool, game_clock::time_point> tick);
+
+public:
+	/// Returns whether the sound started playing
+	bool play(const std::string & path, float volume, voice_priority priority = voice_priority::effect);
+	/// As above, but dropped if the same sound's already been started on the game tick at `tick`, so many entities triggering it at once sound once
+	bool play(const std::string & path, float volume, voice_priority priority, game_clock::time_point tick);
+	/// Decode ahead of time, so the first play() doesn't hit the disk; the sound stays decoded for as long as the result's held
+	audio_cache::handle preload(const std::string & path);
+	std::vector<audio_cache::handle> preload(const std::vector<std::string> & paths);
+	void stop_all();
+	/// Stop every voice and never start another one, for running without anyone listening
+	void mute();
+	/// Scale the volume of every voice, playing and to be played, by `factor` (instead of the previous one)
+	void duck(float factor);
+
+	/// "Voices: X playing, Y stolen, Z dropped"
+	std::string summary();
+
+	voice_pool();
+};
@@ -0,0 +1,225 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "asset_archive.hpp"
+#include "file.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <zstd/zstd.h>
+
+
+static const constexpr char archive_magic[] = "BRASSET1";
+
+
+namespace {
+	class index_reader {
+	private:
+		const char * cur;
+		const char * end;
+
+	public:
+		bool ok = true;
+
+		std::uint64_t integer(std::size_t bytes) {
+			if(static_cast<std::size_t>(end - cur) < bytes) {
+				ok = false;
+				return 0;
+			}
+
+			std::uint64_t ret = 0;
+			for(auto i = 0u; i < bytes; ++i)
+				ret |= static_cast<std::uint64_t>(static_cast<unsigned char>(*cur++)) << (i * 8);
+			return ret;
+		}
+
+		std::string string(std::size_t length) {
+			if(static_cast<std::size_t>(end - cur) < length) {
+				ok = false;
+				return {};
+			}
+
+			std::string ret(cur, length);
+			cur += length;
+			return ret;
+		}
+
+		index_reader(const char * from, const char * to) : cur(from), end(to) {}
+	};
+}
+
+
+bool asset_archive::parse_index() {
+	static const constexpr auto magic_length = sizeof(archive_magic) - 1;
+	if(mapping_size < magic_length || std::memcmp(mapping, archive_magic, magic_length))
+		return false;
+
+	index_reader index(mapping + magic_length, mapping + mapping_size);
+	const auto count = index.integer(4);
+	entries.reserve(count);
+	for(auto i = 0u; i < count && index.ok; ++i) {
+		auto name = index.string(index.integer(4));
+		entry ent;
+		ent.offset      = index.integer(8);
+		ent.stored_size = index.integer(8);
+		ent.size        = index.integer(8);
+		ent.compressed  = index.integer(1);
+
+		if(ent.offset > mapping_size || ent.stored_size > mapping_size - ent.offset || (!ent.compressed && ent.stored_size != ent.size))
+			return false;
+		entries.emplace(std::move(name), std::move(ent));
+	}
+	return index.ok;
+}
+
+asset_archive::view asset_archive::find(const std::string & path) {
+	if(entries.empty() || path.size() <= root.size() || path.compare(0, root.size(), root) || path[root.size()] != '/')
+		return {nullptr, 0};
+	if(loose_first.load(std::memory_order_relaxed) && file_exists(path))
+		return {nullptr, 0};
+
+	const auto itr = entries.find(path.substr(root.size() + 1));
+	if(itr == entries.end())
+		return {nullptr, 0};
+
+	auto & ent = itr->second;
+	if(!ent.compressed)
+		return {mapping + ent.offset, static_cast<std::size_t>(ent.size)};
+
+	std::lock_guard<std::mutex> lock(unpack_lock);
+	if(!ent.unpacked) {
+		auto unpacked            = std::make_unique<std::string>(ent.size, '\0');
+		const auto unpacked_size = ZSTD_decompress(&(*unpacked)[0], unpacked->size(), mapping + ent.offset, ent.stored_size);
+		if(ZSTD_isError(unpacked_size) || unpacked_size != ent.size)
+			return {nullptr, 0};
+		ent.unpacked = std::move(unpacked);
+	}
+	return {ent.unpacked->data(), ent.unpacked->size()};
+}
+
+std::string asset_archive::read(const std::string & path) {
+	if(const auto packed = find(path))
+		return {packed.data, packed.size};
+
+	std::ifstream file(path, std::ios::binary);
+	return {std::istreambuf_iterator<char>(file), {}};
+}
+
+std::vector<std::string> asset_archive::list(const std::string & directory) const {
+	auto files = list_files(directory);
+
+	if(!directory.compare(0, root.size(), root) && (directory.size() == root.size() || directory[root.size()] == '/')) {
+		auto prefix = directory.substr(root.size());
+		if(!prefix.empty())
+			prefix = prefix.substr(1) + '/';
+
+		for(auto && ent : entries)
+			if(!ent.first.compare(0, prefix.size(), prefix) && ent.first.find('/', prefix.size()) == std::string::npos)
+				files.emplace_back(ent.first.substr(prefix.size()));
+	}
+
+	std::sort(files.begin(), files.end());
+	files.erase(std::unique(files.begin(), files.end()), files.end());
+	return files;
+}
+
+void asset_archive::loose_files_first() noexcept {
+	loose_first.store(true, std::memory_order_relaxed);
+}
+
+std::size_t asset_archive::size() const noexcept {
+	return entries.size();
+}
+
+asset_archive::asset_archive(const std::string & archive_path, std::string r)
+      : root(std::move(r)), loose_first(false), mapping(nullptr), mapping_size(0), mapping_handle(nullptr) {
+	map(archive_path);
+	if(mapping && !parse_index())
+		entries.clear();
+}
+
+asset_archive::~asset_archive() {
+	unmap();
+}
+
+
+#ifdef _WIN32
+
+
+#include <windows.h>
+
+
+void asset_archive::map(const std::string & path) {
+	const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER file_size;
+	if(GetFileSizeEx(file, &file_size) && file_size.QuadPart)
+		if((mapping_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr))) {
+			mapping      = static_cast<const char *>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+			mapping_size = mapping ? file_size.QuadPart : 0;
+		}
+	CloseHandle(file);
+}
+
+void asset_archive::unmap() {
+	if(mapping)
+		UnmapViewOfFile(mapping);
+	if(mapping_handle)
+		CloseHandle(mapping_handle);
+}
+
+
+#else
+
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+void asset_archive::map(const std::string & path) {
+	const auto file = open(path.c_str(), O_RDONLY);
+	if(file == -1)
+		return;
+
+	struct stat file_stat;
+	if(fstat(file, &file_stat) == 0 && file_stat.st_size) {
+		const auto mapped = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if(mapped != MAP_FAILED) {
+			mapping      = static_cast<const char *>(mapped);
+			mapping_size = file_stat.st_size;
+		}
+	}
+	close(file);
+}
+
+void asset_archive::unmap() {
+	if(mapping)
+		munmap(const_cast<char *>(mapping), mapping_size);
+}
+
+
+#endif
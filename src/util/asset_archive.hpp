@@ -0,0 +1,108 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+/// A read-only, memory-mapped archive of assets, as packed by tools/asset_packer.cpp, with loose files as a fallback
+///
+/// Entries are looked up by their full path under the root the archive was packed from.
+/// Stored entries are handed out straight from the mapping; compressed ones are decompressed on first access and kept,
+/// so a view stays valid for as long as the archive does.
+///
+/// Format, all integers little-endian:
+///   "BRASSET1", u32 entry count, then for each entry: u32 name length, name (relative to the root, '/'-separated),
+///   u64 offset from the start of the file, u64 stored size, u64 unpacked size, u8 1 if zstd-compressed, else 0
+class asset_archive {
+public:
+	struct view {
+		const char * data;
+		std::size_t size;
+
+		explicit operator bool() const noexcept { return data; }
+	};
+
+private:
+	struct entry {
+		std::uint64_t offset;
+		std::uint64_t stored_size;
+		std::uint64_t size;
+		bool compressed;
+		std::unique_ptr<std::string> unpacked;
+	};
+
+	std::string root;
+	std::atomic<bool> loose_first;
+
+	const char * mapping;
+	std::size_t mapping_size;
+	void * mapping_handle;
+
+	std::unordered_map<std::string, entry> entries;
+	std::mutex unpack_lock;
+
+	void map(const std::string & path);
+	void unmap();
+	bool parse_index();
+
+public:
+	/// Look an asset up by its full path, an empty view if it isn't packed (or, if loose_files_first(), exists loose)
+	view find(const std::string & path);
+	/// Contents of the asset, packed or loose, empty if neither
+	std::string read(const std::string & path);
+	/// Names of files directly in `directory`, packed and loose, each once
+	std::vector<std::string> list(const std::string & directory) const;
+
+	/// Load `into` from the asset via loadFromMemory() if packed, or loadFromFile() if not
+	template <class T>
+	bool load_into(T & into, const std::string & path);
+
+	/// Prefer loose files over packed ones from now on, so edits to them show up; callable while other threads find()
+	void loose_files_first() noexcept;
+
+	std::size_t size() const noexcept;
+
+	/// Map `archive_path` holding assets packed from `root`; a missing or broken archive leaves only loose files
+	asset_archive(const std::string & archive_path, std::string root);
+	~asset_archive();
+
+	asset_archive(const asset_archive &) = delete;
+	asset_archive & operator=(const asset_archive &) = delete;
+};
+
+
+template <class T>
+bool asset_archive::load_into(T & into, const std::string & path) {
+	if(const auto packed = find(path))
+		return into.loadFromMemory(packed.data, packed.size);
+	else
+		return into.loadFromFile(path);
+}
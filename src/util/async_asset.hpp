@@ -0,0 +1,74 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "job_system.hpp"
+#include <functional>
+#include <future>
+#include <mutex>
+
+
+/// A value loaded at most once, either ahead of time on a job_system, or on first access if that hasn't been asked for
+template <class T>
+class async_asset {
+private:
+	std::function<T()> loader;
+	mutable std::once_flag started;
+	mutable std::shared_future<T> value;
+
+public:
+	/// Start loading on `jobs`, unless it's already started
+	void start(job_system & jobs, job_priority priority) const;
+	/// Wait for the value, loading it on the calling thread if it hadn't been started
+	///
+	/// Don't call this from a job running on the job_system it was started on: with every worker blocked, it'd never finish.
+	const T & get() const;
+	operator const T &() const;
+
+	explicit async_asset(std::function<T()> loader);
+};
+
+
+template <class T>
+void async_asset<T>::start(job_system & jobs, job_priority priority) const {
+	std::call_once(started, [&] { value = jobs.submit(priority, loader).share(); });
+}
+
+template <class T>
+const T & async_asset<T>::get() const {
+	std::call_once(started, [&] {
+		std::promise<T> loaded;
+		loaded.set_value(loader());
+		value = loaded.get_future().share();
+	});
+	return value.get();
+}
+
+template <class T>
+async_asset<T>::operator const T &() const {
+	return get();
+}
+
+template <class T>
+async_asset<T>::async_asset(std::function<T()> load) : loader(std::move(load)) {}
@@ -0,0 +1,55 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "coalescing_worker.hpp"
+#include <utility>
+
+
+void coalescing_worker::run() {
+	std::unique_lock<std::mutex> lock(pending_lock);
+	while(pending) {
+		auto job = std::move(pending);
+		pending  = nullptr;
+		lock.unlock();
+		job();
+		lock.lock();
+	}
+
+	running = false;
+	idle_cv.notify_all();
+}
+
+void coalescing_worker::submit(std::function<void()> job) {
+	std::lock_guard<std::mutex> lock(pending_lock);
+	pending = std::move(job);
+	if(!running) {
+		running = true;
+		jobs.submit(priority, [this] { run(); });
+	}
+}
+
+coalescing_worker::coalescing_worker(job_system & js, job_priority prio) : jobs(js), priority(prio), running(false) {}
+
+coalescing_worker::~coalescing_worker() {
+	std::unique_lock<std::mutex> lock(pending_lock);
+	idle_cv.wait(lock, [&] { return !running; });
+}
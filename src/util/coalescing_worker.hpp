@@ -0,0 +1,49 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "job_system.hpp"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+
+/// Runs jobs one at a time on a job_system with room for one job waiting to start; submitting a new job replaces the waiting one
+class coalescing_worker {
+private:
+	job_system & jobs;
+	job_priority priority;
+	std::mutex pending_lock;
+	std::condition_variable idle_cv;
+	std::function<void()> pending;
+	bool running;
+
+	void run();
+
+public:
+	void submit(std::function<void()> job);
+
+	coalescing_worker(job_system & jobs, job_priority priority);
+	~coalescing_worker();
+};
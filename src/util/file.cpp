@@ -25,6 +25,7 @@
 #include <cstring>
 #include <dirent.h>
 #include <memory>
+#include <sys/stat.h>
 
 
 class DIR_deleter {
@@ -63,6 +64,17 @@ bool file_exists(const std::string & path) {
 	return file_exists(path.c_str());
 }
 
+std::time_t file_modification_time(const char * path) {
+	struct stat info;
+	if(stat(path, &info))
+		return 0;
+	return info.st_mtime;
+}
+
+std::time_t file_modification_time(const std::string & path) {
+	return file_modification_time(path.c_str());
+}
+
 void create_directory(const std::string & path) {
 	create_directory(path.c_str());
 }
@@ -82,9 +94,6 @@ void create_directory(const char * path) {
 #else
 
 
-#include <sys/stat.h>
-
-
 void create_directory(const char * path) {
 	mkdir(path, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
 }
@@ -23,6 +23,7 @@
 #pragma once
 
 
+#include <ctime>
 #include <string>
 #include <vector>
 
@@ -34,5 +35,9 @@ std::vector<std::string> list_files(const std::string & directory);
 bool file_exists(const char * path);
 bool file_exists(const std::string & path);
 
+/// When the file was last modified, 0 if it doesn't exist
+std::time_t file_modification_time(const char * path);
+std::time_t file_modification_time(const std::string & path);
+
 void create_directory(const char * path);
 void create_directory(const std::string & path);
@@ -0,0 +1,152 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "file_watch.hpp"
+#include "file.hpp"
+#include <chrono>
+#include <map>
+#include <set>
+#include <sys/stat.h>
+
+
+using namespace std::literals;
+
+
+static const constexpr auto poll_interval = 500ms;
+
+
+void file_watch::watch_polling() {
+	std::vector<std::map<std::string, decltype(stat::st_mtime)>> mtimes(directories.size());
+	const auto scan = [&](bool report) {
+		for(auto i = 0u; i < directories.size(); ++i)
+			for(auto && fname : list_files(directories[i].first)) {
+				struct stat info;
+				if(stat((directories[i].first + '/' + fname).c_str(), &info))
+					continue;
+
+				auto && known = mtimes[i][fname];
+				if(known != info.st_mtime) {
+					known = info.st_mtime;
+					if(report)
+						directories[i].second(fname);
+				}
+			}
+	};
+
+	scan(false);
+	std::unique_lock<std::mutex> lock(stop_lock);
+	while(!stop_cv.wait_for(lock, poll_interval, [&] { return stopping; })) {
+		lock.unlock();
+		scan(true);
+		lock.lock();
+	}
+}
+
+void file_watch::watch(std::string directory, callback on_change) {
+	directories.emplace_back(std::move(directory), std::move(on_change));
+}
+
+void file_watch::start() {
+	watcher = std::thread([&] {
+		if(!watch_notified())
+			watch_polling();
+	});
+}
+
+file_watch::file_watch() : stopping(false) {}
+
+file_watch::~file_watch() {
+	{
+		std::lock_guard<std::mutex> lock(stop_lock);
+		stopping = true;
+	}
+	stop_cv.notify_all();
+
+	if(watcher.joinable())
+		watcher.join();
+}
+
+
+#ifdef __linux__
+
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+
+bool file_watch::watch_notified() {
+	const auto fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(fd == -1)
+		return false;
+
+	std::map<int, std::size_t> watches;
+	for(auto i = 0u; i < directories.size(); ++i) {
+		const auto wd = inotify_add_watch(fd, directories[i].first.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if(wd == -1) {
+			close(fd);
+			return false;
+		}
+		watches.emplace(wd, i);
+	}
+
+	alignas(inotify_event) char buffer[4096];
+	for(;;) {
+		{
+			std::lock_guard<std::mutex> lock(stop_lock);
+			if(stopping)
+				break;
+		}
+
+		pollfd pfd{fd, POLLIN, 0};
+		if(poll(&pfd, 1, 100) <= 0)
+			continue;
+
+		// Editors tend to write a file a few times over when saving, so report each only once per batch
+		std::set<std::pair<std::size_t, std::string>> changed;
+		ssize_t len;
+		while((len = read(fd, buffer, sizeof buffer)) > 0)
+			for(auto cur = buffer; cur < buffer + len;) {
+				const auto event = reinterpret_cast<const inotify_event *>(cur);
+				if(event->len)
+					changed.emplace(watches[event->wd], event->name);
+				cur += sizeof(inotify_event) + event->len;
+			}
+
+		for(auto && file : changed)
+			directories[file.first].second(file.second);
+	}
+
+	close(fd);
+	return true;
+}
+
+
+#else
+
+
+bool file_watch::watch_notified() {
+	return false;
+}
+
+
+#endif
@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/// Calls back, on its own thread, with the names of files written to in the watched directories.
+///
+/// Uses inotify on Linux, falling back to comparing modification times every `poll_interval` elsewhere or if that fails.
+class file_watch {
+public:
+	using callback = std::function<void(const std::string & filename)>;
+
+private:
+	std::vector<std::pair<std::string, callback>> directories;
+	std::mutex stop_lock;
+	std::condition_variable stop_cv;
+	bool stopping;
+	std::thread watcher;
+
+	bool watch_notified();
+	void watch_polling();
+
+public:
+	/// Only valid before start()
+	void watch(std::string directory, callback on_change);
+	void start();
+
+	file_watch();
+	~file_watch();
+};
@@ -0,0 +1,88 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "frame_pacer.hpp"
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+
+using namespace std::literals;
+
+
+static const constexpr auto calibrate_every   = 32u;
+static const constexpr auto min_spin_margin   = 250us;
+static const constexpr auto max_spin_fraction = 2;  // Never spin for more than 1/max_spin_fraction of an interval
+
+
+void frame_pacer::calibrate() {
+	frames_since_calibration = 0;
+	// A quarter on top of the worst recent oversleep, since the next one may well be a little worse
+	const auto worst = oversleep.max();
+	spin_margin      = std::min(std::max<duration>(worst + worst / 4, min_spin_margin), interval / max_spin_fraction);
+}
+
+void frame_pacer::wait() {
+	auto now = std::chrono::steady_clock::now();
+	if(deadline + interval < now) {  // Too far behind to catch up, start over from here
+		deadline = now;
+		skip();
+	} else {
+		const auto sleep_until = deadline - spin_margin;
+		if(sleep_until > now) {
+			std::this_thread::sleep_until(sleep_until);
+			now = std::chrono::steady_clock::now();
+			oversleep.record(std::max<duration>(now - sleep_until, duration::zero()));
+			if(++frames_since_calibration >= calibrate_every)
+				calibrate();
+		}
+		while(now < deadline) {
+			std::this_thread::yield();
+			now = std::chrono::steady_clock::now();
+		}
+	}
+	deadline += interval;
+
+	if(last_frame != std::chrono::steady_clock::time_point{}) {
+		const auto this_interval = now - last_frame;
+		if(last_interval != duration::zero())
+			jitter.record(this_interval > last_interval ? this_interval - last_interval : last_interval - this_interval);
+		last_interval = this_interval;
+	}
+	last_frame = now;
+}
+
+void frame_pacer::skip() noexcept {
+	last_frame    = {};
+	last_interval = duration::zero();
+}
+
+std::string frame_pacer::summary() const {
+	std::ostringstream out;
+	out.precision(3);
+	out << std::fixed << jitter.summary("Frame jitter") << ", spinning for the last " << std::chrono::duration<double, std::milli>(spin_margin).count() << " ms";
+	return out.str();
+}
+
+frame_pacer::frame_pacer(unsigned int FPS)
+      : interval(std::chrono::duration_cast<duration>(std::chrono::duration<double>(1. / std::max(FPS, 1u)))), deadline(std::chrono::steady_clock::now()),
+        last_interval(duration::zero()), spin_margin(std::chrono::duration_cast<duration>(2ms)), frames_since_calibration(0), oversleep(calibrate_every * 4) {}
@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include "timing_stats.hpp"
+#include <chrono>
+#include <string>
+
+
+/// Holds frames to a fixed rate more tightly than sf::Window::setFramerateLimit(): sleeps through most of what's left of the interval, then spins to
+/// its end; how early to stop sleeping follows the worst recent oversleep
+class frame_pacer {
+public:
+	using duration = std::chrono::steady_clock::duration;
+
+private:
+	duration interval;
+	std::chrono::steady_clock::time_point deadline;
+	std::chrono::steady_clock::time_point last_frame;
+	duration last_interval;
+	duration spin_margin;
+	unsigned int frames_since_calibration;
+
+	timing_stats oversleep;
+	timing_stats jitter;
+
+	void calibrate();
+
+public:
+	/// Wait until the next frame's due, call right after presenting one
+	void wait();
+	/// Don't measure the gap after the frame just presented as jitter, for when frames aren't meant to keep to the rate (idle screens, background throttling)
+	void skip() noexcept;
+
+	/// "Frame jitter: p50 X ms, p99 Y ms, max Z ms over N samples, spinning for the last W ms"
+	std::string summary() const;
+
+	explicit frame_pacer(unsigned int FPS);
+};
@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "job_system.hpp"
+#include <algorithm>
+
+
+static thread_local std::size_t current_worker_queue = -1;
+
+
+void job_system::enqueue(job_priority priority, std::function<void()> job) {
+	auto queue_id = current_worker_queue;
+	if(queue_id >= queues.size())
+		queue_id = next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+	{
+		auto & queue = *queues[queue_id];
+		std::lock_guard<std::mutex> lock(queue.lock);
+		queue.jobs[static_cast<std::size_t>(priority)].emplace_back(std::move(job));
+	}
+	queued.fetch_add(1, std::memory_order_release);
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_lock);
+	}
+	sleep_cv.notify_one();
+}
+
+// Owners take from the back of their own queue, thieves from the front of everyone else's.
+// An out-of-range `own_queue` only steals.
+bool job_system::try_pop(std::size_t own_queue, job_priority lowest, std::function<void()> & into) {
+	for(auto priority = 0u; priority <= static_cast<std::size_t>(lowest); ++priority) {
+		if(own_queue < queues.size()) {
+			auto & queue = *queues[own_queue];
+			std::lock_guard<std::mutex> lock(queue.lock);
+			auto & jobs = queue.jobs[priority];
+			if(!jobs.empty()) {
+				into = std::move(jobs.back());
+				jobs.pop_back();
+				queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		for(auto i = 1u; i <= queues.size(); ++i) {
+			const auto victim = (own_queue + i) % queues.size();
+			if(victim == own_queue)
+				continue;
+
+			auto & queue = *queues[victim];
+			std::lock_guard<std::mutex> lock(queue.lock);
+			auto & jobs = queue.jobs[priority];
+			if(!jobs.empty()) {
+				into = std::move(jobs.front());
+				jobs.pop_front();
+				queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void job_system::run(std::size_t id) {
+	current_worker_queue = id;
+
+	std::function<void()> job;
+	for(;;) {
+		if(try_pop(id, job_priority::compression, job)) {
+			job();
+			job = nullptr;
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleep_lock);
+		sleep_cv.wait(lock, [&] { return stopping.load(std::memory_order_acquire) || queued.load(std::memory_order_acquire); });
+		if(stopping.load(std::memory_order_acquire) && !queued.load(std::memory_order_acquire))
+			return;
+	}
+}
+
+job_system::job_system(std::size_t threads) : queued(0), next_queue(0), stopping(false) {
+	if(!threads)
+		threads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+	queues.reserve(threads);
+	for(auto i = 0u; i < threads; ++i)
+		queues.emplace_back(std::make_unique<worker_queue>());
+
+	workers.reserve(threads);
+	for(auto i = 0u; i < threads; ++i)
+		workers.emplace_back(&job_system::run, this, i);
+}
+
+job_system::~job_system() {
+	{
+		std::lock_guard<std::mutex> lock(sleep_lock);
+		stopping.store(true, std::memory_order_release);
+	}
+	sleep_cv.notify_all();
+
+	for(auto && worker : workers)
+		worker.join();
+}
+
+std::size_t job_system::size() const noexcept {
+	return workers.size();
+}
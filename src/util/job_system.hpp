@@ -0,0 +1,93 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+/// In order of precedence
+enum class job_priority : unsigned char {
+	simulation,
+	assets,
+	io,
+	compression,
+};
+
+
+/// Fixed-size work-stealing thread pool
+///
+/// Every worker has its own queue per priority; idle workers steal from the others' queues before going to sleep.
+/// Jobs still queued when the pool is destroyed are run to completion first.
+class job_system {
+private:
+	static const constexpr auto priority_count = static_cast<std::size_t>(job_priority::compression) + 1;
+
+	struct worker_queue {
+		std::mutex lock;
+		std::array<std::deque<std::function<void()>>, priority_count> jobs;
+	};
+
+	std::vector<std::unique_ptr<worker_queue>> queues;
+	std::vector<std::thread> workers;
+	std::atomic<std::size_t> queued;
+	std::atomic<std::size_t> next_queue;
+	std::atomic<bool> stopping;
+	std::mutex sleep_lock;
+	std::condition_variable sleep_cv;
+
+	void enqueue(job_priority priority, std::function<void()> job);
+	bool try_pop(std::size_t own_queue, job_priority lowest, std::function<void()> & into);
+	void run(std::size_t id);
+
+public:
+	/// 0 threads means one less than the amount of hardware threads, but at least one
+	explicit job_system(std::size_t threads);
+	~job_system();
+
+	std::size_t size() const noexcept;
+
+	template <class F>
+	std::future<std::result_of_t<std::decay_t<F>()>> submit(job_priority priority, F && job);
+};
+
+
+template <class F>
+std::future<std::result_of_t<std::decay_t<F>()>> job_system::submit(job_priority priority, F && job) {
+	using result_t = std::result_of_t<std::decay_t<F>()>;
+
+	auto task   = std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(job));
+	auto result = task->get_future();
+	enqueue(priority, [task = std::move(task)] { (*task)(); });
+	return result;
+}
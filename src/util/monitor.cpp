@@ -41,7 +41,9 @@ unsigned int refresh_rate() {
 
 
 unsigned int refresh_rate() {
-	auto dpy  = XOpenDisplay(nullptr);
+	auto dpy = XOpenDisplay(nullptr);
+	if(!dpy)
+		return 0;
 	auto root = RootWindow(dpy, 0);
 
 	const auto conf         = XRRGetScreenInfo(dpy, root);
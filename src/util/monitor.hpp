@@ -23,4 +23,5 @@
 #pragma once
 
 
+/// 0 if there's no display to ask
 unsigned int refresh_rate();
@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <utility>
+
+
+/// Unbounded lock-free multi-producer single-consumer queue
+///
+/// Based on Dmitry Vyukov's non-intrusive MPSC node-based queue:
+/// http://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
+template <class T>
+class mpsc_queue {
+private:
+	struct node {
+		std::atomic<node *> next;
+		T value;
+
+		node() : next(nullptr) {}
+		node(T && val) : next(nullptr), value(std::move(val)) {}
+	};
+
+	std::atomic<node *> head;  // Producers push here
+	node * tail;               // The consumer pops here
+
+public:
+	/// Callable from any thread
+	void push(T value) {
+		const auto n    = new node(std::move(value));
+		const auto prev = head.exchange(n, std::memory_order_acq_rel);
+		prev->next.store(n, std::memory_order_release);
+	}
+
+	/// Callable only from the consumer thread
+	bool pop(T & into) {
+		const auto next = tail->next.load(std::memory_order_acquire);
+		if(!next)
+			return false;
+
+		into = std::move(next->value);
+		delete tail;
+		tail = next;
+		return true;
+	}
+
+	/// Callable only from the consumer thread
+	bool empty() const { return !tail->next.load(std::memory_order_acquire); }
+
+
+	mpsc_queue() : head(new node), tail(head.load(std::memory_order_relaxed)) {}
+	mpsc_queue(const mpsc_queue &) = delete;
+	mpsc_queue & operator=(const mpsc_queue &) = delete;
+
+	~mpsc_queue() {
+		while(const auto next = tail->next.load(std::memory_order_relaxed)) {
+			delete tail;
+			tail = next;
+		}
+		delete tail;
+	}
+};
@@ -0,0 +1,93 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "startup_profile.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+
+namespace {
+	struct phase_record {
+		std::string name;
+		std::chrono::steady_clock::time_point begin;
+		std::chrono::steady_clock::time_point end;
+	};
+
+	struct phase_list {
+		std::mutex lock;
+		std::vector<phase_record> phases;
+	};
+}
+
+
+static phase_list & recorded_phases() {
+	static phase_list phases;
+	return phases;
+}
+
+static thread_local std::chrono::steady_clock::time_point last_phase_end = startup_origin();
+
+
+std::chrono::steady_clock::time_point startup_origin() {
+	static const auto origin = std::chrono::steady_clock::now();
+	return origin;
+}
+
+std::chrono::steady_clock::time_point startup_phase(std::string phase, std::chrono::steady_clock::time_point since) {
+	const auto now = std::chrono::steady_clock::now();
+	last_phase_end = now;
+
+	auto & recorded = recorded_phases();
+	std::lock_guard<std::mutex> lock(recorded.lock);
+	recorded.phases.push_back({std::move(phase), since, now});
+	return now;
+}
+
+std::chrono::steady_clock::time_point startup_phase(std::string phase) {
+	return startup_phase(std::move(phase), last_phase_end);
+}
+
+std::string startup_profile_summary() {
+	auto & recorded = recorded_phases();
+	std::unique_lock<std::mutex> lock(recorded.lock);
+	auto phases = recorded.phases;
+	lock.unlock();
+
+	std::stable_sort(phases.begin(), phases.end(), [](auto && lhs, auto && rhs) { return lhs.end < rhs.end; });
+
+	const auto origin = startup_origin();
+	const auto ms     = [](auto dur) { return std::chrono::duration<double, std::milli>(dur).count(); };
+	std::size_t name_width = 0;
+	for(auto && phase : phases)
+		name_width = std::max(name_width, phase.name.size());
+
+	std::ostringstream out;
+	out.precision(3);
+	out << std::fixed;
+	for(auto && phase : phases)
+		out << std::left << std::setw(name_width) << phase.name << std::right << ": " << std::setw(10) << ms(phase.begin - origin) << " ms -> "
+		    << std::setw(10) << ms(phase.end - origin) << " ms (" << ms(phase.end - phase.begin) << " ms)\n";
+	return out.str();
+}
@@ -0,0 +1,51 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+
+/// When the startup profile starts counting, fixed on first call
+std::chrono::steady_clock::time_point startup_origin();
+
+/// Record `phase` as having taken from `since` until now, callable from any thread
+std::chrono::steady_clock::time_point startup_phase(std::string phase, std::chrono::steady_clock::time_point since);
+/// Record `phase` as having taken from the end of the previous phase on this thread (or startup_origin()) until now
+std::chrono::steady_clock::time_point startup_phase(std::string phase);
+
+/// Wrap `f` to record each call of it as `phase`
+template <class F>
+auto startup_timed(std::string phase, F && f) {
+	return [ phase = std::move(phase), f = std::forward<F>(f) ] {
+		const auto since = std::chrono::steady_clock::now();
+		auto ret         = f();
+		startup_phase(phase, since);
+		return ret;
+	};
+}
+
+/// Every phase recorded so far, ordered by when they ended, one per line, in ms since startup_origin()
+std::string startup_profile_summary();
@@ -0,0 +1,75 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "timing_stats.hpp"
+#include <algorithm>
+#include <sstream>
+
+
+timing_stats::timing_stats(std::size_t cap) : capacity(cap), next_sample(0) {
+	samples.reserve(capacity);
+}
+
+void timing_stats::record(duration sample) {
+	if(samples.size() < capacity)
+		samples.emplace_back(sample);
+	else
+		samples[next_sample] = sample;
+	next_sample = (next_sample + 1) % capacity;
+}
+
+void timing_stats::lap() {
+	const auto now = std::chrono::steady_clock::now();
+	if(last_lap != std::chrono::steady_clock::time_point{})
+		record(now - last_lap);
+	last_lap = now;
+}
+
+std::size_t timing_stats::count() const noexcept {
+	return samples.size();
+}
+
+timing_stats::duration timing_stats::percentile(double fraction) const {
+	if(samples.empty())
+		return {};
+
+	auto sorted    = samples;
+	const auto nth  = sorted.begin() + std::min<std::size_t>(fraction * sorted.size(), sorted.size() - 1);
+	std::nth_element(sorted.begin(), nth, sorted.end());
+	return *nth;
+}
+
+timing_stats::duration timing_stats::max() const {
+	if(samples.empty())
+		return {};
+	return *std::max_element(samples.begin(), samples.end());
+}
+
+std::string timing_stats::summary(const char * name) const {
+	const auto ms = [](auto dur) { return std::chrono::duration<double, std::milli>(dur).count(); };
+
+	std::ostringstream out;
+	out.precision(3);
+	out << std::fixed << name << ": p50 " << ms(percentile(.5)) << " ms, p99 " << ms(percentile(.99)) << " ms, max " << ms(max()) << " ms over " << count()
+	    << " samples";
+	return out.str();
+}
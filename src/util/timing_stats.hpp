@@ -0,0 +1,55 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+/// Keeps the last `capacity` samples of some duration, for percentile reporting
+class timing_stats {
+public:
+	using duration = std::chrono::steady_clock::duration;
+
+private:
+	std::vector<duration> samples;
+	std::size_t capacity;
+	std::size_t next_sample;
+	std::chrono::steady_clock::time_point last_lap;
+
+public:
+	explicit timing_stats(std::size_t capacity = 4096);
+
+	void record(duration sample);
+	/// Record the time since the previous lap(), the first call only starts the clock
+	void lap();
+
+	std::size_t count() const noexcept;
+	duration percentile(double fraction) const;
+	duration max() const;
+
+	/// "name: p50 X ms, p99 Y ms, max Z ms over N samples"
+	std::string summary(const char * name) const;
+};
@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <array>
+#include <atomic>
+
+
+/// Lock-free single-producer single-consumer triple buffer
+///
+/// The producer fills write_buffer() and publish()es it, the consumer update()s and reads read_buffer(), neither ever waits for the other.
+template <class T>
+class triple_buffer {
+private:
+	static const constexpr unsigned char fresh_bit = 0b100;
+
+	std::array<T, 3> buffers{};
+	std::atomic<unsigned char> middle{1};
+	unsigned char back  = 0;
+	unsigned char front = 2;
+
+public:
+	/// Producer only
+	T & write_buffer() noexcept { return buffers[back]; }
+
+	/// Producer only
+	void publish() noexcept { back = middle.exchange(back | fresh_bit, std::memory_order_acq_rel) & ~fresh_bit; }
+
+	/// Consumer only, returns whether a newer buffer was published since the last call
+	bool update() noexcept {
+		if(!(middle.load(std::memory_order_relaxed) & fresh_bit))
+			return false;
+
+		front = middle.exchange(front, std::memory_order_acq_rel) & ~fresh_bit;
+		return true;
+	}
+
+	/// Consumer only
+	const T & read_buffer() const noexcept { return buffers[front]; }
+};
@@ -0,0 +1,111 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <chrono>
+
+
+/// Curves mapping linear progress ∈ [0..1] onto eased progress ∈ [0..1]
+namespace easing {
+	float linear(float progress) noexcept;
+	/// Starts slow, p²
+	float quadratic_in(float progress) noexcept;
+	/// Ends slow, 1 - (1 - p)²
+	float quadratic_out(float progress) noexcept;
+}
+
+
+/// A fixed-length animation driven by elapsed time on `Clock` instead of by counting frames
+///
+/// Use game_clock for anything the simulation owns, so it pauses and replays with it, and std::chrono::steady_clock for pure UI.
+template <class Clock>
+class tween {
+public:
+	using duration   = typename Clock::duration;
+	using time_point = typename Clock::time_point;
+
+private:
+	time_point begin;
+	duration length;
+	bool begun;
+
+public:
+	void start(time_point now) noexcept;
+	bool started() const noexcept;
+	/// Started and not yet finished
+	bool running(time_point now) const noexcept;
+	time_point end() const noexcept;
+
+	/// Linear progress ∈ [0..1], 0 before start() and 1 after the end
+	float progress(time_point now) const noexcept;
+	/// Progress through the [from..to] part of the whole tween, rescaled to [0..1]
+	float progress(time_point now, float from, float to) const noexcept;
+
+	explicit tween(duration length = duration::zero()) noexcept;
+};
+
+
+template <class Clock>
+void tween<Clock>::start(time_point now) noexcept {
+	begin = now;
+	begun = true;
+}
+
+template <class Clock>
+bool tween<Clock>::started() const noexcept {
+	return begun;
+}
+
+template <class Clock>
+bool tween<Clock>::running(time_point now) const noexcept {
+	return begun && now < end();
+}
+
+template <class Clock>
+typename tween<Clock>::time_point tween<Clock>::end() const noexcept {
+	return begin + length;
+}
+
+template <class Clock>
+float tween<Clock>::progress(time_point now) const noexcept {
+	if(!begun)
+		return 0;
+	if(length <= duration::zero())
+		return 1;
+
+	const auto elapsed = std::chrono::duration<float>(now - begin) / std::chrono::duration<float>(length);
+	return std::min(std::max(elapsed, 0.f), 1.f);
+}
+
+template <class Clock>
+float tween<Clock>::progress(time_point now, float from, float to) const noexcept {
+	if(to <= from)
+		return progress(now) >= to;
+
+	return std::min(std::max((progress(now) - from) / (to - from), 0.f), 1.f);
+}
+
+template <class Clock>
+tween<Clock>::tween(duration len) noexcept : begin(), length(len), begun(false) {}
@@ -0,0 +1,127 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Packs assets into an archive for asset_archive (see src/util/asset_archive.hpp for the format).
+//
+// Usage: asset_packer OUTPUT ROOT FILE...
+//   Every FILE must be under ROOT, and is stored under its path relative to it,
+//   zstd-compressed if that saves at least an eighth of its size, as is otherwise.
+
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <zstd/zstd.h>
+
+
+static const constexpr char archive_magic[] = "BRASSET1";
+
+
+struct packed_entry {
+	std::string name;
+	std::string data;
+	std::uint64_t size;
+	bool compressed;
+};
+
+
+static void write_integer(std::ostream & out, std::uint64_t value, std::size_t bytes) {
+	for(auto i = 0u; i < bytes; ++i)
+		out.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+static bool pack(const std::string & root, const std::string & path, packed_entry & into) {
+	if(path.size() <= root.size() + 1 || path.compare(0, root.size(), root) || path[root.size()] != '/') {
+		std::cerr << path << " isn't under " << root << '\n';
+		return false;
+	}
+
+	std::ifstream file(path, std::ios::binary);
+	if(!file) {
+		std::cerr << "Couldn't open " << path << '\n';
+		return false;
+	}
+
+	into.name       = path.substr(root.size() + 1);
+	into.data       = {std::istreambuf_iterator<char>(file), {}};
+	into.size       = into.data.size();
+	into.compressed = false;
+
+	std::string compressed(ZSTD_compressBound(into.data.size()), '\0');
+	const auto compressed_size = ZSTD_compress(&compressed[0], compressed.size(), into.data.data(), into.data.size(), ZSTD_maxCLevel());
+	if(!ZSTD_isError(compressed_size) && compressed_size < into.data.size() - into.data.size() / 8) {
+		compressed.resize(compressed_size);
+		into.data       = std::move(compressed);
+		into.compressed = true;
+	}
+	return true;
+}
+
+
+int main(int argc, char * argv[]) {
+	if(argc < 3) {
+		std::cerr << "Usage: " << argv[0] << " OUTPUT ROOT FILE...\n";
+		return 1;
+	}
+
+	std::string root = argv[2];
+	while(root.size() > 1 && root.back() == '/')
+		root.pop_back();
+
+	std::vector<packed_entry> entries(argc - 3);
+	for(auto i = 3; i < argc; ++i)
+		if(!pack(root, argv[i], entries[i - 3]))
+			return 1;
+
+	std::uint64_t index_size = sizeof(archive_magic) - 1 + 4;
+	for(auto && ent : entries)
+		index_size += 4 + ent.name.size() + 8 + 8 + 8 + 1;
+
+	std::ofstream out(argv[1], std::ios::binary);
+	out.write(archive_magic, sizeof(archive_magic) - 1);
+	write_integer(out, entries.size(), 4);
+	auto offset = index_size;
+	for(auto && ent : entries) {
+		write_integer(out, ent.name.size(), 4);
+		out.write(ent.name.data(), ent.name.size());
+		write_integer(out, offset, 8);
+		write_integer(out, ent.data.size(), 8);
+		write_integer(out, ent.size, 8);
+		write_integer(out, ent.compressed, 1);
+		offset += ent.data.size();
+	}
+	for(auto && ent : entries)
+		out.write(ent.data.data(), ent.data.size());
+
+	if(!out) {
+		std::cerr << "Couldn't write " << argv[1] << '\n';
+		return 1;
+	}
+
+	std::uint64_t unpacked_size = 0;
+	for(auto && ent : entries)
+		unpacked_size += ent.size;
+	std::cout << "Packed " << entries.size() << " files, " << unpacked_size << " bytes into " << offset << '\n';
+}
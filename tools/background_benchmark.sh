@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+# The MIT License (MIT)
+
+# Copyright (c) 2014 nabijaczleweli
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# Usage: background_benchmark.sh RECORDING EXECUTABLE [SECONDS]
+#
+# Replays RECORDING in a window under Xvfb, and measures EXECUTABLE's CPU usage over SECONDS (default 10) while it has focus,
+# then over as long again after focus has been moved to the root window, printing both.
+# Where the RAPL counters are readable (usually only by root), the CPU package's average power draw is printed too;
+# that's the whole machine's, so keep it otherwise idle. RECORDING needs to last at least twice SECONDS, plus a few for startup.
+#
+# Needs xvfb-run, xdotool and xwininfo.
+
+set -eu
+
+if [ -z "${BACKGROUND_BENCHMARK_DISPLAY:-}" ]; then
+	command -v xvfb-run > /dev/null || { echo "xvfb-run not found" >&2; exit 1; }
+	BACKGROUND_BENCHMARK_DISPLAY=1 exec xvfb-run -a -s "-screen 0 1280x720x24" "$0" "$@"
+fi
+
+recording="$(readlink -f "$1")"
+exe="$(readlink -f "$2")"
+seconds="${3:-10}"
+rapl=/sys/class/powercap/intel-rapl:0/energy_uj
+
+command -v xdotool > /dev/null || { echo "xdotool not found" >&2; exit 1; }
+command -v xwininfo > /dev/null || { echo "xwininfo not found" >&2; exit 1; }
+
+
+"$exe" --replay "$recording" > /dev/null 2>&1 &
+pid=$!
+trap 'kill "$pid" 2> /dev/null || true' EXIT
+
+cpu_ticks() {
+	# utime and stime, after the parenthesised command name, which may contain spaces
+	sed 's/^.*) //' "/proc/$pid/stat" | awk '{ print $12 + $13 }'
+}
+
+energy() {
+	if [ -r "$rapl" ]; then cat "$rapl"; else echo; fi
+}
+
+measure() {
+	local ticks_before energy_before ticks_after energy_after
+	ticks_before="$(cpu_ticks)"
+	energy_before="$(energy)"
+	sleep "$seconds"
+	ticks_after="$(cpu_ticks)"
+	energy_after="$(energy)"
+
+	awk -v name="$1" -v ticks="$((ticks_after - ticks_before))" -v hz="$(getconf CLK_TCK)" -v seconds="$seconds" \
+	    -v energy_before="$energy_before" -v energy_after="$energy_after" \
+	    'BEGIN {
+	       printf "%s: %.1f%% CPU", name, ticks / hz / seconds * 100
+	       if(energy_before != "" && energy_after >= energy_before)
+	         printf ", %.2f W package", (energy_after - energy_before) / 1000000 / seconds
+	       printf " over %d s\n", seconds
+	     }'
+}
+
+
+window="$(xdotool search --sync --name '^BarbersAndRebarbs$' | head -n1)"
+xdotool windowfocus "$window"
+sleep 3  # For startup to settle
+measure "Focused"
+
+xdotool windowfocus "$(xwininfo -root | awk '/Window id:/ { print $4 }')"
+sleep 1
+measure "Background"
@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+# The MIT License (MIT)
+
+# Copyright (c) 2014 nabijaczleweli
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# Usage: fire_test.sh RECORDING EXECUTABLE [RUNS]
+#
+# Replays RECORDING (say, fire_test_recording's 50 players firing full-auto) under Xvfb RUNS times (default 3) with sound effects on,
+# then as many times with them off, and prints the CPU time each took, the difference being what mixing the voices cost,
+# along with the voice pool's statistics from the last run with sound.
+#
+# Needs GNU time and an audio device to play to (a PulseAudio null sink will do).
+# EXECUTABLE's BarbersAndRebarbs.cfg is changed for the runs and put back afterwards.
+
+set -eu
+
+recording="$(readlink -f "$1")"
+exe="$(readlink -f "$2")"
+runs="${3:-3}"
+config="$(dirname "$exe")/BarbersAndRebarbs.cfg"
+
+command -v xvfb-run > /dev/null || { echo "xvfb-run not found" >&2; exit 1; }
+[ -x /usr/bin/time ] || { echo "/usr/bin/time not found" >&2; exit 1; }
+
+
+run() {
+	xvfb-run -a -s "-screen 0 1280x720x24" "$@"
+}
+
+# The config's only written out on exit, so have it written once first
+[ -f "$config" ] || run "$exe" --exit-after-first-frame > /dev/null 2>&1
+scratch="$(mktemp -d)"
+cp "$config" "$scratch/original.cfg"
+trap 'cp "$scratch/original.cfg" "$config"; rm -rf "$scratch"' EXIT
+
+cpu_seconds() {
+	sed -i "s/\"play_sounds\": [a-z]*/\"play_sounds\": $1/" "$config"
+	run /usr/bin/time -f '%U %S' -o "$scratch/time" "$exe" --replay "$recording" --print-stats > "$scratch/out" 2> /dev/null
+	awk '{ print $1 + $2 }' "$scratch/time"
+}
+
+average() {
+	grep . | awk '{ sum += $1 } END { printf "%.2f", sum / NR }'
+}
+
+
+with=""
+for _ in $(seq "$runs"); do
+	with="$with$(cpu_seconds true)"$'\n'
+done
+grep -E '^(Voices|Audio cache): ' "$scratch/out" || true
+
+without=""
+for _ in $(seq "$runs"); do
+	without="$without$(cpu_seconds false)"$'\n'
+done
+
+with="$(printf '%s' "$with" | average)"
+without="$(printf '%s' "$without" | average)"
+echo "With sound effects: $with s of CPU time, without: $without s, averaged over $runs runs"
+awk -v with="$with" -v without="$without" 'BEGIN { printf "Sound effects cost %.2f s of CPU time\n", with - without }'
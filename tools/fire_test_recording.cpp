@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2017 nabijaczleweli
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Writes a recording (see doc/recording.md for the format) of PLAYERS players all holding down the trigger
+// of a GUN for SECONDS, reloading every few seconds, with the cursor circling the middle of the screen,
+// for benchmarking heavy scenes with --replay.
+//
+// Usage: fire_test_recording OUTPUT PLAYERS SECONDS [GUN]
+//   GUN defaults to "pepesza", the fastest-firing full-auto one.
+
+
+#include <SFML/Window.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <zstd/zstd.h>
+
+
+static const constexpr char recording_magic[8] = {'B', 'A', 'R', 'R', 'E', 'C', '\0', '\2'};
+static const constexpr std::uint32_t world_width  = 1280;
+static const constexpr std::uint32_t world_height = 720;
+static const constexpr std::uint32_t tick_rate    = 60;
+static const constexpr std::uint32_t reload_every = 5 * tick_rate;
+
+
+template <class T>
+static void write_raw(std::string & into, const T & what) {
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written raw");
+	into.append(reinterpret_cast<const char *>(&what), sizeof what);
+}
+
+static std::string initial_save(unsigned int players, const std::string & gun) {
+	// Spread out on a grid, far enough from the edges to not get stuck on them
+	const auto columns = static_cast<unsigned int>(std::ceil(std::sqrt(players)));
+	const auto rows    = (players + columns - 1) / std::max(columns, 1u);
+
+	std::string save = "{";
+	for(auto i = 0u; i < players; ++i) {
+		const auto x = world_width * (i % columns + 1) / (columns + 1);
+		const auto y = world_height * (i / columns + 1) / (rows + 1);
+		save += (i ? ",\"" : "\"") + std::to_string(i) + "\":{\"kind\":\"player\",\"id\":" + std::to_string(i) + ",\"x\":" + std::to_string(x) +
+		        ",\"y\":" + std::to_string(y) + ",\"motion_x\":0,\"motion_y\":0,\"hp\":1,\"gun\":{\"id\":\"" + gun + "\",\"left_mags\":1000}}";
+	}
+	return save + '}';
+}
+
+static void write_tick(std::string & into, sf::Vector2i mouse, const std::vector<sf::Event> & events) {
+	write_raw(into, static_cast<std::uint8_t>(0));
+	write_raw(into, static_cast<std::int32_t>(mouse.x));
+	write_raw(into, static_cast<std::int32_t>(mouse.y));
+	write_raw(into, static_cast<std::uint16_t>(events.size()));
+	for(auto && event : events)
+		write_raw(into, event);
+}
+
+static sf::Event mouse_event(sf::Event::EventType type, sf::Vector2i at) {
+	sf::Event event{};
+	event.type               = type;
+	event.mouseButton.button = sf::Mouse::Left;
+	event.mouseButton.x      = at.x;
+	event.mouseButton.y      = at.y;
+	return event;
+}
+
+static sf::Event reload_event() {
+	sf::Event event{};
+	event.type     = sf::Event::KeyPressed;
+	event.key.code = sf::Keyboard::R;
+	return event;
+}
+
+
+int main(int argc, char * argv[]) {
+	if(argc < 4) {
+		std::cerr << "Usage: " << argv[0] << " OUTPUT PLAYERS SECONDS [GUN]\n";
+		return 1;
+	}
+
+	const auto players = std::strtoul(argv[2], nullptr, 10);
+	const auto ticks   = std::strtoul(argv[3], nullptr, 10) * tick_rate;
+	const std::string gun(argc > 4 ? argv[4] : "pepesza");
+
+	const auto save = initial_save(players, gun);
+	std::string data(recording_magic, sizeof recording_magic);
+	write_raw(data, static_cast<std::uint32_t>(0));
+	write_raw(data, world_width);
+	write_raw(data, world_height);
+	write_raw(data, tick_rate);
+	write_raw(data, static_cast<std::uint64_t>(save.size()));
+	data += save;
+
+	std::vector<sf::Event> events;
+	for(auto tick = 0ul; tick <= ticks; ++tick) {
+		const auto angle = 2 * 3.14159265358979 * tick / (2 * tick_rate);  // A full circle every two seconds
+		const sf::Vector2i mouse(world_width / 2 + std::cos(angle) * world_height / 3, world_height / 2 + std::sin(angle) * world_height / 3);
+
+		events.clear();
+		if(tick == 0)
+			events.emplace_back(mouse_event(sf::Event::MouseButtonPressed, mouse));
+		else if(tick == ticks)
+			events.emplace_back(mouse_event(sf::Event::MouseButtonReleased, mouse));
+		else if(tick % reload_every == 0)
+			events.emplace_back(reload_event());
+		write_tick(data, mouse, events);
+	}
+
+	// Compressed like savefiles, see doc/save.md
+	std::string compressed(ZSTD_compressBound(data.size()), '\0');
+	const auto compressed_size = ZSTD_compress(&compressed[0], compressed.size(), data.data(), data.size(), ZSTD_maxCLevel());
+	if(ZSTD_isError(compressed_size)) {
+		std::cerr << "Couldn't compress the recording: " << ZSTD_getErrorName(compressed_size) << '\n';
+		return 1;
+	}
+
+	std::string file;
+	write_raw(file, static_cast<std::uint64_t>(data.size()));
+	write_raw(file, static_cast<std::uint64_t>(compressed_size));
+	file.append(compressed, 0, compressed_size);
+
+	std::ofstream out(argv[1], std::ios::binary);
+	out.write(file.data(), file.size());
+	if(!out) {
+		std::cerr << "Couldn't write " << argv[1] << '\n';
+		return 1;
+	}
+
+	std::cout << "Recorded " << players << " players firing " << gun << " for " << ticks << " ticks into " << argv[1] << '\n';
+}
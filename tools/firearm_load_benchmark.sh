@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# The MIT License (MIT)
+
+# Copyright (c) 2014 nabijaczleweli
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# Usage: firearm_load_benchmark.sh RECORDING EXECUTABLE [GUNS] [RUNS]
+#
+# Copies EXECUTABLE and its assets somewhere temporary, adds GUNS (default 500) generated gun definitions to them, like a heavily modded install,
+# then replays RECORDING headlessly RUNS times (default 10) and prints firearm table load time percentiles.
+# Run from the directory EXECUTABLE was built from, since it finds its libraries relative to it.
+
+set -eu
+
+recording="$(readlink -f "$1")"
+exe="$(readlink -f "$2")"
+guns="${3:-500}"
+runs="${4:-10}"
+
+exe_dir="$(dirname "$exe")"
+install="$(mktemp -d)"
+trap 'rm -rf "$install"' EXIT
+
+
+cp "$exe" "$install/"
+[ -f "$exe_dir/assets.pak" ] && cp "$exe_dir/assets.pak" "$install/"
+mkdir -p "$install/assets/guns"
+[ -d "$exe_dir/assets" ] && cp -r "$exe_dir/assets/." "$install/assets/"
+
+for i in $(seq "$guns"); do
+	cat > "$install/assets/guns/modded_$i.json" <<-GUN
+		{
+			"id": "modded_$i",
+			"name": "Modded gun #$i",
+			"bullet": {
+				"speed": 3.$i,
+				"speed_loss": 0.0075
+			},
+			"fire_mode": "full-auto",
+			"action_speed": 0.1,
+			"reload_speed": 2,
+			"mag_size": 30,
+			"mag_quantity": 5,
+			"sounds": {
+				"shoot": ["fire/colt45_01.wav"],
+				"reload": "reload/colt45_reload.wav"
+			}
+		}
+	GUN
+done
+
+
+times=""
+for _ in $(seq "$runs"); do
+	times="$times$("$install/$(basename "$exe")" --replay "$recording" --headless 2> /dev/null | sed -n 's/^Loaded [0-9]* firearms in \([0-9.]*\) ms$/\1/p')"$'\n'
+done
+
+printf '%s' "$times" | grep . | sort -n | awk -v guns="$guns" '{ v[NR] = $1 }
+                                                         END {
+                                                           if(!NR) { print "No samples"; exit }
+                                                           printf "Loading with %d extra guns: p50 %.3f ms, p90 %.3f ms, max %.3f ms over %d runs\n",
+                                                                  guns, v[int((NR - 1) * .5) + 1], v[int((NR - 1) * .9) + 1], v[NR], NR
+                                                         }'
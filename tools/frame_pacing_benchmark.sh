@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+# The MIT License (MIT)
+
+# Copyright (c) 2014 nabijaczleweli
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# Usage: frame_pacing_benchmark.sh RECORDING EXECUTABLE...
+#
+# Replays RECORDING (say, one written by fire_test_recording) in a window under Xvfb with each EXECUTABLE in turn
+# and prints its frame interval, frame jitter and simulation tick statistics, so builds can be compared on the same heavy scene.
+#
+# Xvfb doesn't wait for vertical sync, so set "vsync" to false in each EXECUTABLE's BarbersAndRebarbs.cfg to have frames paced to "FPS";
+# otherwise they're drawn as fast as they can be.
+
+set -eu
+
+recording="$(readlink -f "$1")"
+shift
+
+command -v xvfb-run > /dev/null || { echo "xvfb-run not found" >&2; exit 1; }
+
+
+for exe in "$@"; do
+	echo "$exe:"
+	xvfb-run -a -s "-screen 0 1280x720x24" "$(readlink -f "$exe")" --replay "$recording" --print-stats 2> /dev/null |
+	  grep -E '^(Frame interval|Frame jitter|Simulation tick|Input to present): ' | sed 's/^/  /'
+done
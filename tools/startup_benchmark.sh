@@ -0,0 +1,83 @@
+#!/usr/bin/env bash
+# The MIT License (MIT)
+
+# Copyright (c) 2014 nabijaczleweli
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# Usage: startup_benchmark.sh EXECUTABLE [RUNS]
+#
+# Starts EXECUTABLE RUNS times (default 10) under Xvfb with --exit-after-first-frame, once cold and once warm,
+# and prints time-to-first-frame percentiles for both.
+#
+# Cold runs drop the page cache before each start, which needs root (or passwordless sudo);
+# without it every cold run but the first one is really warm, and a warning is printed.
+
+set -eu
+
+exe="$(readlink -f "$1")"
+runs="${2:-10}"
+
+command -v xvfb-run > /dev/null || { echo "xvfb-run not found" >&2; exit 1; }
+
+
+drop_caches() {
+	sync
+	if [ -w /proc/sys/vm/drop_caches ]; then
+		echo 3 > /proc/sys/vm/drop_caches
+	elif sudo -n true 2> /dev/null; then
+		echo 3 | sudo -n tee /proc/sys/vm/drop_caches > /dev/null
+	else
+		return 1
+	fi
+}
+
+first_frame_ms() {
+	xvfb-run -a -s "-screen 0 1280x720x24" "$exe" --exit-after-first-frame 2> /dev/null | sed -n 's/^First frame displayed after \([0-9]*\)ms$/\1/p'
+}
+
+percentiles() {
+	sort -n | awk -v name="$1" '{ v[NR] = $1 }
+	                            END {
+	                              if(!NR) { print name ": no samples"; exit }
+	                              p50 = v[int((NR - 1) * .5) + 1]
+	                              p90 = v[int((NR - 1) * .9) + 1]
+	                              printf "%s: p50 %d ms, p90 %d ms, max %d ms over %d runs\n", name, p50, p90, v[NR], NR
+	                            }'
+}
+
+
+cold=""
+warned=""
+for _ in $(seq "$runs"); do
+	if ! drop_caches && [ -z "$warned" ]; then
+		echo "Can't drop the page cache, cold runs won't be cold" >&2
+		warned=1
+	fi
+	cold="$cold$(first_frame_ms)"$'\n'
+done
+
+first_frame_ms > /dev/null
+warm=""
+for _ in $(seq "$runs"); do
+	warm="$warm$(first_frame_ms)"$'\n'
+done
+
+printf '%s' "$cold" | grep . | percentiles "Cold start"
+printf '%s' "$warm" | grep . | percentiles "Warm start"